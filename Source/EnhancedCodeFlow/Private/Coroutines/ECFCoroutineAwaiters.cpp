@@ -83,21 +83,49 @@ void FECFCoroutineAwaiter_WaitForFlag::await_suspend(FECFCoroutineHandle InCoroH
 	AddCoroutineAction<UECFWaitForFlag>(Owner, InCoroHandle, Settings, bFlag, TimeOut);
 }
 
+/*^^^ Wait For Signal Coroutine Awaiter ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^*/
+
+FECFCoroutineAwaiter_WaitForSignal::FECFCoroutineAwaiter_WaitForSignal(const UObject* InOwner, const FECFActionSettings& InSettings, const FECFSignal& InSignal, float InTimeOut)
+{
+	Owner = InOwner;
+	Settings = InSettings;
+
+	Signal = InSignal;
+	TimeOut = InTimeOut;
+}
+
+void FECFCoroutineAwaiter_WaitForSignal::await_suspend(FECFCoroutineHandle InCoroHandle)
+{
+	AddCoroutineAction<UECFWaitForSignal>(Owner, InCoroHandle, Settings, Signal, TimeOut);
+}
+
 /*^^^ Run Async And Wait Coroutine Awaiter ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^*/
 
-FECFCoroutineAwaiter_RunAsyncAndWait::FECFCoroutineAwaiter_RunAsyncAndWait(const UObject* InOwner, const FECFActionSettings& InSettings, TUniqueFunction<void()>&& InAsyncTaskFunc, float InTimeOut, EECFAsyncPrio InThreadPriority)
+FECFCoroutineAwaiter_RunAsyncAndWait::FECFCoroutineAwaiter_RunAsyncAndWait(const UObject* InOwner, const FECFActionSettings& InSettings, TUniqueFunction<void(const FECFCancellationToken&)>&& InAsyncTaskFunc, float InTimeOut, EECFAsyncPrio InThreadPriority)
+{
+	Owner = InOwner;
+	Settings = InSettings;
+
+	if (InAsyncTaskFunc)
+	{
+		AsyncJob = MakeECFAsyncJob<void>(MoveTemp(InAsyncTaskFunc), []() {});
+	}
+	TimeOut = InTimeOut;
+	ThreadPriority = InThreadPriority;
+}
+
+FECFCoroutineAwaiter_RunAsyncAndWait::FECFCoroutineAwaiter_RunAsyncAndWait(const UObject* InOwner, const FECFActionSettings& InSettings, float InTimeOut, EECFAsyncPrio InThreadPriority)
 {
 	Owner = InOwner;
 	Settings = InSettings;
 
-	AsyncTaskFunction = MoveTemp(InAsyncTaskFunc);
 	TimeOut = InTimeOut;
 	ThreadPriority = InThreadPriority;
 }
 
 void FECFCoroutineAwaiter_RunAsyncAndWait::await_suspend(FECFCoroutineHandle InCoroHandle)
 {
-	AddCoroutineAction<UECFRunAsyncAndWait>(Owner, InCoroHandle, Settings, MoveTemp(AsyncTaskFunction), TimeOut, ThreadPriority);
+	AddCoroutineAction<UECFRunAsyncAndWait>(Owner, InCoroHandle, Settings, MoveTemp(AsyncJob), TimeOut, ThreadPriority);
 }
 
 /*^^^ Wait Load Objects Coroutine Awaiter ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^*/
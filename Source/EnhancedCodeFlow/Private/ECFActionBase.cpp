@@ -3,7 +3,9 @@
 #pragma once
 
 #include "ECFActionBase.h"
+#include "ECFSubsystem.h"
 #include "ECFStats.h"
+#include "Async/Async.h"
 
 ECF_PRAGMA_DISABLE_OPTIMIZATION
 
@@ -11,6 +13,8 @@ DEFINE_STAT(STAT_ECF_ActionsObjectsCount);
 
 UECFActionBase::UECFActionBase()
 {
+	Settings = FECFActionSettingsRegistry::GetDefault();
+
 #if STATS
 	INC_DWORD_STAT(STAT_ECF_ActionsObjectsCount);
 #endif
@@ -23,4 +27,101 @@ UECFActionBase::~UECFActionBase()
 #endif
 }
 
+void UECFActionBase::Park(float InDeadlineTime/* = 0.f*/)
+{
+	if (UECFSubsystem* ECF = Cast<UECFSubsystem>(GetOuter()))
+	{
+		ECF->ParkAction(this, InDeadlineTime);
+	}
+}
+
+void UECFActionBase::WaitForActionTime(float InWaitTime, float InCurrentTime/* = 0.f*/)
+{
+	WaitEndTime = InWaitTime;
+
+	// The first delay is a part of the deadline, so it doesn't have to be counted down every tick.
+	const float TimeLeft = ActionDelayLeft + InWaitTime - InCurrentTime;
+	ActionDelayLeft = 0.f;
+
+	if (TimeLeft > 0.f)
+	{
+		Park(TimeLeft);
+	}
+	else if (bIsParked)
+	{
+		// The time has already passed, so the action continues with the next tick.
+		if (UECFSubsystem* ECF = Cast<UECFSubsystem>(GetOuter()))
+		{
+			ECF->WakeAction(this);
+		}
+	}
+}
+
+float UECFActionBase::GetWaitedActionTime() const
+{
+	return FMath::Max(static_cast<float>(WaitEndTime - GetParkTimeLeft()), 0.f);
+}
+
+double UECFActionBase::GetParkTimeLeft() const
+{
+	if (bIsParked == false || ParkTimeLeft <= 0.f)
+	{
+		return 0.0;
+	}
+
+	// Paused action keeps the time left frozen. Otherwise it is derived from the absolute deadline.
+	if (bIsPaused)
+	{
+		return ParkTimeLeft;
+	}
+
+	const UECFSubsystem* ECF = Cast<UECFSubsystem>(GetOuter());
+	if (ECF && ECF->Clocks.IsValidIndex(ClockIndex))
+	{
+		return FMath::Max(ParkDeadline - ECF->Clocks[ClockIndex].Now, 0.0);
+	}
+	return 0.0;
+}
+
+FECFAsyncCompletion UECFActionBase::GetAsyncCompletion()
+{
+	FECFAsyncCompletion AsyncCompletion;
+	if (UECFSubsystem* ECF = Cast<UECFSubsystem>(GetOuter()))
+	{
+		AsyncCompletion.Action = this;
+		AsyncCompletion.Subsystem = ECF;
+		AsyncCompletion.CompletionQueue = ECF->CompletionQueue;
+		AsyncCompletion.bImmediateContinuation = Settings->bImmediateContinuation;
+	}
+	return AsyncCompletion;
+}
+
+void UECFActionBase::LaunchAsyncTask(ENamedThreads::Type ThreadType, TUniqueFunction<void()>&& Work)
+{
+	if (Settings->bSerializeAsyncPerOwner || Settings->AsyncLane.IsNone() == false)
+	{
+		if (UECFSubsystem* ECF = Cast<UECFSubsystem>(GetOuter()))
+		{
+			TSharedPtr<FECFAsyncLane, ESPMode::ThreadSafe> AsyncLane;
+			if (Settings->AsyncLane.IsNone() == false)
+			{
+				AsyncLane = ECF->GetAsyncLane(Settings->AsyncLane);
+			}
+
+			if (Settings->bSerializeAsyncPerOwner && ECF->AsyncPipes.IsValid())
+			{
+				ECF->AsyncPipes->Submit(FECFAsyncPipeKey(Owner.Get(), Settings->AsyncPipe), MoveTemp(Work), ThreadType, MoveTemp(AsyncLane), Settings->AsyncPriority);
+				return;
+			}
+			else if (AsyncLane.IsValid())
+			{
+				AsyncLane->Submit(MoveTemp(Work), ThreadType, Settings->AsyncPriority);
+				return;
+			}
+		}
+	}
+
+	AsyncTask(ThreadType, MoveTemp(Work));
+}
+
 ECF_PRAGMA_ENABLE_OPTIMIZATION
\ No newline at end of file
@@ -0,0 +1,170 @@
+// Copyright (c) 2026 Damian Nowakowski. All rights reserved.
+
+#include "ECFActionSettings.h"
+#include "Misc/ScopeRWLock.h"
+#include "Templates/UniquePtr.h"
+
+ECF_PRAGMA_DISABLE_OPTIMIZATION
+
+namespace ECFActionSettingsRegistry
+{
+	// Storage of all interned settings. Interned settings are never removed, so pointers to them are stable.
+	struct FStorage
+	{
+		FRWLock Lock;
+		TArray<TUniquePtr<FECFActionSettings>> Settings;
+		TMultiMap<uint32, const FECFActionSettings*> SettingsByHash;
+		FECFActionSettings Default;
+	};
+
+	FStorage& GetStorage()
+	{
+		static FStorage Storage;
+		return Storage;
+	}
+
+	// Only used to narrow down the search. Settings are matched by their equality operator.
+	uint32 GetSettingsHash(const FECFActionSettings& InSettings)
+	{
+		const uint32 Hash = HashCombine(GetTypeHash(InSettings.TickInterval), GetTypeHash(InSettings.FirstDelay));
+		return HashCombine(Hash, GetTypeHash(InSettings.Label));
+	}
+
+	const FECFActionSettings* Find(const FStorage& Storage, const FECFActionSettings& InSettings, uint32 Hash)
+	{
+		for (auto It = Storage.SettingsByHash.CreateConstKeyIterator(Hash); It; ++It)
+		{
+			if (*It.Value() == InSettings)
+			{
+				return It.Value();
+			}
+		}
+		return nullptr;
+	}
+}
+
+const FECFActionSettings* FECFActionSettingsRegistry::FindShared(const FECFActionSettings& InSettings)
+{
+	// Reused settings objects already know their interned copy.
+	if (InSettings.CachedInterned && *InSettings.CachedInterned == InSettings)
+	{
+		return InSettings.CachedInterned;
+	}
+
+	// Most actions are launched with default settings.
+	const FECFActionSettings* Default = GetDefault();
+	if (*Default == InSettings)
+	{
+		return Default;
+	}
+
+	return nullptr;
+}
+
+const FECFActionSettings* FECFActionSettingsRegistry::Intern(const FECFActionSettings& InSettings)
+{
+	using namespace ECFActionSettingsRegistry;
+
+	if (const FECFActionSettings* SharedSettings = FindShared(InSettings))
+	{
+		return SharedSettings;
+	}
+
+	FStorage& Storage = GetStorage();
+	const uint32 Hash = GetSettingsHash(InSettings);
+	{
+		FReadScopeLock ReadLock(Storage.Lock);
+		if (const FECFActionSettings* Found = Find(Storage, InSettings, Hash))
+		{
+			return Found;
+		}
+	}
+
+	FWriteScopeLock WriteLock(Storage.Lock);
+
+	// Another thread could intern the same settings in the meantime.
+	if (const FECFActionSettings* Found = Find(Storage, InSettings, Hash))
+	{
+		return Found;
+	}
+
+	FECFActionSettings* NewSettings = Storage.Settings.Add_GetRef(MakeUnique<FECFActionSettings>(InSettings)).Get();
+	NewSettings->CachedInterned = NewSettings;
+	Storage.SettingsByHash.Add(Hash, NewSettings);
+	return NewSettings;
+}
+
+const FECFActionSettings* FECFActionSettingsRegistry::GetDefault()
+{
+	return &ECFActionSettingsRegistry::GetStorage().Default;
+}
+
+int32 FECFActionSettingsRegistry::Num()
+{
+	ECFActionSettingsRegistry::FStorage& Storage = ECFActionSettingsRegistry::GetStorage();
+	FReadScopeLock ReadLock(Storage.Lock);
+	return Storage.Settings.Num() + 1;
+}
+
+const FECFActionSettings* FECFActionSettings::Intern() const
+{
+	CachedInterned = FECFActionSettingsRegistry::Intern(*this);
+	return CachedInterned;
+}
+
+const FECFActionSettings& FECFActionSettings::DefaultPreset()
+{
+	static const FECFActionSettings Preset = []()
+	{
+		FECFActionSettings Settings;
+		Settings.Intern();
+		return Settings;
+	}();
+	return Preset;
+}
+
+const FECFActionSettings& FECFActionSettings::IgnorePausePreset()
+{
+	static const FECFActionSettings Preset = []()
+	{
+		FECFActionSettings Settings = FECFActionSettings().WithIgnorePause();
+		Settings.Intern();
+		return Settings;
+	}();
+	return Preset;
+}
+
+const FECFActionSettings& FECFActionSettings::IgnoreTimeDilationPreset()
+{
+	static const FECFActionSettings Preset = []()
+	{
+		FECFActionSettings Settings = FECFActionSettings().WithIgnoreGlobalTimeDilation();
+		Settings.Intern();
+		return Settings;
+	}();
+	return Preset;
+}
+
+const FECFActionSettings& FECFActionSettings::IgnorePauseDilationPreset()
+{
+	static const FECFActionSettings Preset = []()
+	{
+		FECFActionSettings Settings = FECFActionSettings().WithIgnorePause().WithIgnoreGlobalTimeDilation();
+		Settings.Intern();
+		return Settings;
+	}();
+	return Preset;
+}
+
+const FECFActionSettings& FECFActionSettings::StartPausedPreset()
+{
+	static const FECFActionSettings Preset = []()
+	{
+		FECFActionSettings Settings = FECFActionSettings().WithStartPaused();
+		Settings.Intern();
+		return Settings;
+	}();
+	return Preset;
+}
+
+ECF_PRAGMA_ENABLE_OPTIMIZATION
@@ -0,0 +1,31 @@
+// Copyright (c) 2026 Damian Nowakowski. All rights reserved.
+
+#include "ECFAsyncCompletion.h"
+#include "ECFSubsystem.h"
+#include "Async/Async.h"
+
+ECF_PRAGMA_DISABLE_OPTIMIZATION
+
+void FECFAsyncCompletion::Signal() const
+{
+	if (CompletionQueue.IsValid() == false)
+	{
+		return;
+	}
+
+	CompletionQueue->Enqueue(Action);
+
+	// Don't wait for the next ECF tick, wake the action up as soon as the Game Thread processes its tasks.
+	if (bImmediateContinuation)
+	{
+		AsyncTask(ENamedThreads::GameThread, [WeakSubsystem = Subsystem]()
+		{
+			if (UECFSubsystem* ECF = WeakSubsystem.Get())
+			{
+				ECF->WakeCompletedActions(true);
+			}
+		});
+	}
+}
+
+ECF_PRAGMA_ENABLE_OPTIMIZATION
\ No newline at end of file
@@ -0,0 +1,116 @@
+// Copyright (c) 2026 Damian Nowakowski. All rights reserved.
+
+#include "ECFAsyncLane.h"
+#include "Async/Async.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/ScopeLock.h"
+
+ECF_PRAGMA_DISABLE_OPTIMIZATION
+
+void FECFAsyncLane::Submit(TUniqueFunction<void()>&& Work, ENamedThreads::Type ThreadType, int32 Priority)
+{
+	FTask Task;
+	Task.Work = MoveTemp(Work);
+	Task.ThreadType = ThreadType;
+	Task.Priority = Priority;
+	Task.QueuedTime = FPlatformTime::Seconds();
+
+	{
+		FScopeLock Lock(&CriticalSection);
+		if (InFlight >= MaxInFlight)
+		{
+			Task.Sequence = NextSequence++;
+			Backlog.HeapPush(MoveTemp(Task), FTaskPredicate());
+			return;
+		}
+		InFlight++;
+	}
+
+	Dispatch(MoveTemp(Task));
+}
+
+void FECFAsyncLane::SetMaxInFlight(int32 InMaxInFlight)
+{
+	TArray<FTask, TInlineAllocator<4>> TasksToStart;
+	{
+		FScopeLock Lock(&CriticalSection);
+		MaxInFlight = FMath::Max(InMaxInFlight, 1);
+		while (InFlight < MaxInFlight && Backlog.Num() > 0)
+		{
+			Backlog.HeapPop(TasksToStart.AddDefaulted_GetRef(), FTaskPredicate());
+			InFlight++;
+		}
+	}
+
+	for (FTask& Task : TasksToStart)
+	{
+		Dispatch(MoveTemp(Task));
+	}
+}
+
+FECFAsyncLaneStats FECFAsyncLane::GetStats() const
+{
+	FScopeLock Lock(&CriticalSection);
+
+	FECFAsyncLaneStats Stats;
+	Stats.MaxInFlight = MaxInFlight;
+	Stats.InFlight = InFlight;
+	Stats.QueueDepth = Backlog.Num();
+	Stats.CompletedTasks = CompletedTasks;
+	Stats.MaxWaitTime = MaxWaitTime;
+	Stats.MaxRunTime = MaxRunTime;
+	if (CompletedTasks > 0)
+	{
+		Stats.AverageWaitTime = TotalWaitTime / CompletedTasks;
+		Stats.AverageRunTime = TotalRunTime / CompletedTasks;
+	}
+	return Stats;
+}
+
+void FECFAsyncLane::Dispatch(FTask&& Task)
+{
+	const ENamedThreads::Type ThreadType = Task.ThreadType;
+	AsyncTask(ThreadType, [Lane = AsShared(), Task = MoveTemp(Task)]() mutable
+	{
+		Lane->Run(Task);
+	});
+}
+
+void FECFAsyncLane::Run(FTask& Task)
+{
+	const double StartTime = FPlatformTime::Seconds();
+	Task.Work();
+	const double EndTime = FPlatformTime::Seconds();
+
+	FTask NextTask;
+	bool bHasNextTask = false;
+	{
+		FScopeLock Lock(&CriticalSection);
+
+		const double WaitTime = StartTime - Task.QueuedTime;
+		const double RunTime = EndTime - StartTime;
+		CompletedTasks++;
+		TotalWaitTime += WaitTime;
+		TotalRunTime += RunTime;
+		MaxWaitTime = FMath::Max(MaxWaitTime, WaitTime);
+		MaxRunTime = FMath::Max(MaxRunTime, RunTime);
+
+		// Pass the slot to the next task, unless the limit has been lowered in the meantime.
+		if (Backlog.Num() > 0 && InFlight <= MaxInFlight)
+		{
+			Backlog.HeapPop(NextTask, FTaskPredicate());
+			bHasNextTask = true;
+		}
+		else
+		{
+			InFlight--;
+		}
+	}
+
+	if (bHasNextTask)
+	{
+		Dispatch(MoveTemp(NextTask));
+	}
+}
+
+ECF_PRAGMA_ENABLE_OPTIMIZATION
\ No newline at end of file
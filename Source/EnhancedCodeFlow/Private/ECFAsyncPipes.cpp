@@ -0,0 +1,82 @@
+// Copyright (c) 2026 Damian Nowakowski. All rights reserved.
+
+#include "ECFAsyncPipes.h"
+#include "Async/Async.h"
+#include "Misc/ScopeLock.h"
+
+ECF_PRAGMA_DISABLE_OPTIMIZATION
+
+void FECFAsyncPipes::Submit(const FECFAsyncPipeKey& Key, TUniqueFunction<void()>&& Work, ENamedThreads::Type ThreadType, TSharedPtr<FECFAsyncLane, ESPMode::ThreadSafe> Lane, int32 Priority)
+{
+	FTask Task;
+	Task.Work = MoveTemp(Work);
+	Task.ThreadType = ThreadType;
+	Task.Lane = MoveTemp(Lane);
+	Task.Priority = Priority;
+
+	{
+		FScopeLock Lock(&CriticalSection);
+
+		// The pipe exists only while its task is running, so wait for it.
+		if (FPipe* Pipe = Pipes.Find(Key))
+		{
+			Pipe->Waiting.Add(MoveTemp(Task));
+			return;
+		}
+		Pipes.Add(Key);
+	}
+
+	Start(Key, MoveTemp(Task));
+}
+
+int32 FECFAsyncPipes::Num() const
+{
+	FScopeLock Lock(&CriticalSection);
+	return Pipes.Num();
+}
+
+void FECFAsyncPipes::Start(const FECFAsyncPipeKey& Key, FTask&& Task)
+{
+	TUniqueFunction<void()> PipedWork = [SharedThis = AsShared(), Key, Work = MoveTemp(Task.Work)]()
+	{
+		Work();
+		SharedThis->Continue(Key);
+	};
+
+	if (Task.Lane.IsValid())
+	{
+		Task.Lane->Submit(MoveTemp(PipedWork), Task.ThreadType, Task.Priority);
+	}
+	else
+	{
+		AsyncTask(Task.ThreadType, MoveTemp(PipedWork));
+	}
+}
+
+void FECFAsyncPipes::Continue(const FECFAsyncPipeKey& Key)
+{
+	FTask NextTask;
+	{
+		FScopeLock Lock(&CriticalSection);
+
+		FPipe* Pipe = Pipes.Find(Key);
+		if (Pipe == nullptr)
+		{
+			return;
+		}
+
+		if (Pipe->Waiting.Num() == 0)
+		{
+			Pipes.Remove(Key);
+			return;
+		}
+
+		// Pipes are usually short, so removing from the front is cheap enough.
+		NextTask = MoveTemp(Pipe->Waiting[0]);
+		Pipe->Waiting.RemoveAt(0);
+	}
+
+	Start(Key, MoveTemp(NextTask));
+}
+
+ECF_PRAGMA_ENABLE_OPTIMIZATION
\ No newline at end of file
@@ -0,0 +1,42 @@
+// Copyright (c) 2026 Damian Nowakowski. All rights reserved.
+
+#include "ECFClock.h"
+#include "Engine/World.h"
+#include "GameFramework/GameStateBase.h"
+#include "HAL/PlatformTime.h"
+
+ECF_PRAGMA_DISABLE_OPTIMIZATION
+
+float FECFRealTimeClock::Advance(const FECFClockContext& Context)
+{
+	const double Now = FPlatformTime::Seconds();
+	const float DeltaTime = LastTime < 0.0 ? Context.DeltaTime : static_cast<float>(Now - LastTime);
+	LastTime = Now;
+	return DeltaTime;
+}
+
+float FECFServerTimeClock::Advance(const FECFClockContext& Context)
+{
+	const AGameStateBase* GameState = Context.World ? Context.World->GetGameState() : nullptr;
+	if (GameState == nullptr)
+	{
+		return 0.f;
+	}
+
+	// The server time can be corrected backwards when it is replicated, so the clock never goes back.
+	const double Now = GameState->GetServerWorldTimeSeconds();
+	const float DeltaTime = LastTime < 0.0 ? 0.f : FMath::Max(static_cast<float>(Now - LastTime), 0.f);
+	LastTime = FMath::Max(Now, LastTime);
+	return DeltaTime;
+}
+
+float FECFScaledClock::Advance(const FECFClockContext& Context)
+{
+	if (Context.bIsWorldPaused)
+	{
+		return 0.f;
+	}
+	return Context.DeltaTime * Context.TimeDilation * TimeScale;
+}
+
+ECF_PRAGMA_ENABLE_OPTIMIZATION
\ No newline at end of file
@@ -2,10 +2,9 @@
 
 #include "ECFInstanceId.h"
 
-uint64 FECFInstanceId::DynamicIdCounter = 0;
+TAtomic<uint64> FECFInstanceId::DynamicIdCounter(0);
 
 FECFInstanceId FECFInstanceId::NewId()
 {
-	DynamicIdCounter++;
-	return FECFInstanceId(DynamicIdCounter);
+	return FECFInstanceId(++DynamicIdCounter);
 }
\ No newline at end of file
@@ -0,0 +1,53 @@
+// Copyright (c) 2026 Damian Nowakowski. All rights reserved.
+
+#include "ECFSignal.h"
+#include "Misc/ScopeLock.h"
+
+ECF_PRAGMA_DISABLE_OPTIMIZATION
+
+void FECFSignal::Set() const
+{
+	TArray<FWaiter> WaitersToWake;
+	{
+		FScopeLock Lock(&State->WaitersLock);
+		State->bIsSet = true;
+		WaitersToWake = MoveTemp(State->Waiters);
+	}
+
+	// Completions only enqueue the wake up, so they are signaled outside of the lock.
+	for (const FWaiter& Waiter : WaitersToWake)
+	{
+		Waiter.Completion.Signal();
+	}
+}
+
+void FECFSignal::Reset() const
+{
+	FScopeLock Lock(&State->WaitersLock);
+	State->bIsSet = false;
+}
+
+bool FECFSignal::AddWaiter(const UECFActionBase* InAction, FECFAsyncCompletion&& InCompletion) const
+{
+	FScopeLock Lock(&State->WaitersLock);
+	if (State->bIsSet)
+	{
+		return false;
+	}
+
+	FWaiter& Waiter = State->Waiters.AddDefaulted_GetRef();
+	Waiter.Action = InAction;
+	Waiter.Completion = MoveTemp(InCompletion);
+	return true;
+}
+
+void FECFSignal::RemoveWaiter(const UECFActionBase* InAction) const
+{
+	FScopeLock Lock(&State->WaitersLock);
+	State->Waiters.RemoveAllSwap([InAction](const FWaiter& Waiter)
+	{
+		return Waiter.Action == InAction;
+	});
+}
+
+ECF_PRAGMA_ENABLE_OPTIMIZATION
\ No newline at end of file
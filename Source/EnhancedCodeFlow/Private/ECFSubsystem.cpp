@@ -4,11 +4,42 @@
 #include "ECFActionBase.h"
 #include "Engine/Engine.h"
 #include "Engine/GameInstance.h"
+#include "GameFramework/Actor.h"
+#include "GameFramework/PlayerController.h"
+#include "Components/SceneComponent.h"
+#include "GameFramework/WorldSettings.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/App.h"
+#include "Async/ParallelFor.h"
+#include "UObject/UObjectGlobals.h"
+#include "Runtime/Launch/Resources/Version.h"
+
+#if (ENGINE_MAJOR_VERSION > 5) || (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 4)
+#define ECF_NO_SHRINKING EAllowShrinking::No
+#else
+#define ECF_NO_SHRINKING false
+#endif
 
 ECF_PRAGMA_DISABLE_OPTIMIZATION
 
 DEFINE_STAT(STAT_ECF_ActionsCount);
 DEFINE_STAT(STAT_ECF_InstancesCount);
+DEFINE_STAT(STAT_ECF_PrePhysicsActionsCount);
+DEFINE_STAT(STAT_ECF_PostPhysicsActionsCount);
+DEFINE_STAT(STAT_ECF_EndOfFrameActionsCount);
+DEFINE_STAT(STAT_ECF_ParkedActionsCount);
+DEFINE_STAT(STAT_ECF_AsyncTasksInFlightCount);
+DEFINE_STAT(STAT_ECF_QueuedAsyncTasksCount);
+DEFINE_STAT(STAT_ECF_AsyncPipesCount);
+DEFINE_STAT(STAT_ECF_DeferredActionsCount);
+DEFINE_STAT(STAT_ECF_ParallelTickedActionsCount);
+DEFINE_STAT(STAT_ECF_TickBudgetOverrun);
+
+#if STATS
+DECLARE_CYCLE_STAT(TEXT("Tick Pre Physics"), STAT_ECF_TickPrePhysics, STATGROUP_ECF);
+DECLARE_CYCLE_STAT(TEXT("Tick Post Physics"), STAT_ECF_TickPostPhysics, STATGROUP_ECF);
+DECLARE_CYCLE_STAT(TEXT("Tick End Of Frame"), STAT_ECF_TickEndOfFrame, STATGROUP_ECF);
+#endif
 
 void UECFSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
@@ -27,13 +58,102 @@ void UECFSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 	}
 
 	// Reset the HandleId counter
-	LastHandleId.Invalidate();
+	LastHandleId = 0;
+
+	CompletionQueue = MakeShared<FECFCompletionQueue, ESPMode::ThreadSafe>();
+	AsyncPipes = MakeShared<FECFAsyncPipes, ESPMode::ThreadSafe>();
+
+	Clocks.SetNum(BuiltInClocksNum);
+
+	// Tick functions of the tick groups other than Default are registered in the world when first needed.
+	TickGroups.SetNum(TickGroupsNum);
+	const ETickingGroup EngineTickGroups[TickGroupsNum] = { TG_PrePhysics, TG_PrePhysics, TG_PostPhysics, TG_PostUpdateWork };
+	for (int32 GroupIndex = 1; GroupIndex < TickGroupsNum; GroupIndex++)
+	{
+		FECFTickFunction& TickFunction = TickFunctions[GroupIndex];
+		TickFunction.Subsystem = this;
+		TickFunction.Group = static_cast<EECFTickGroup>(GroupIndex);
+		TickFunction.TickGroup = EngineTickGroups[GroupIndex];
+		TickFunction.bCanEverTick = true;
+		TickFunction.bStartWithTickEnabled = true;
+		TickFunction.bTickEvenWhenPaused = true;
+		TickFunction.bAllowTickOnDedicatedServer = true;
+	}
+
+	PostGarbageCollectHandle = FCoreUObjectDelegates::GetPostGarbageCollect().AddUObject(this, &UECFSubsystem::OnPostGarbageCollect);
 }
 
 void UECFSubsystem::Deinitialize()
 {
-	Actions.Empty();
-	PendingAddActions.Empty();
+	bCanTick = false;
+
+	FCoreUObjectDelegates::GetPostGarbageCollect().Remove(PostGarbageCollectHandle);
+	for (TPair<FObjectKey, FECFTrackedOwner>& TrackedOwner : TrackedOwners)
+	{
+		if (TrackedOwner.Value.bIsBoundToActor)
+		{
+			if (AActor* OwnerActor = Cast<AActor>(const_cast<UObject*>(TrackedOwner.Value.Owner.Get())))
+			{
+				OwnerActor->OnDestroyed.RemoveDynamic(this, &UECFSubsystem::OnTrackedActorDestroyed);
+				OwnerActor->OnEndPlay.RemoveDynamic(this, &UECFSubsystem::OnTrackedActorEndPlay);
+			}
+		}
+	}
+	TrackedOwners.Empty();
+
+	QueuedActions.Empty();
+	QueuedCommands.Empty();
+
+	for (FECFTickFunction& TickFunction : TickFunctions)
+	{
+		if (TickFunction.IsTickFunctionRegistered())
+		{
+			TickFunction.UnRegisterTickFunction();
+		}
+		TickFunction.Subsystem = nullptr;
+	}
+
+	// Let the actions clean up (e.g. cancel their async work) before they are gone.
+	ForEachActionsList([](const TArray<UECFActionBase*>& ActionsList)
+	{
+		for (UECFActionBase* Action : ActionsList)
+		{
+			if (Action)
+			{
+				Action->Removed();
+			}
+		}
+	});
+	for (FECFTickGroupActions& TickGroupActions : TickGroups)
+	{
+		TickGroupActions.Actions.Empty();
+		TickGroupActions.PendingAddActions.Empty();
+	}
+	for (UECFActionBase* ParkedAction : ParkedActions)
+	{
+		if (ParkedAction)
+		{
+			ParkedAction->bIsParked = false;
+			ParkedAction->ParkedIndex = INDEX_NONE;
+		}
+	}
+	ParkedActions.Empty();
+
+	// Async work finished after this point signals its own copy of the queue, which is never read again.
+	if (CompletionQueue.IsValid())
+	{
+		CompletionQueue->Empty();
+		CompletionQueue.Reset();
+	}
+	Clocks.Empty();
+	CustomClockIndices.Empty();
+	ActionGroups.Empty();
+	ActionGroupIndices.Empty();
+	ActionGroupClockIndices.Empty();
+
+	// Tasks already submitted keep their lanes and pipes alive until they are done.
+	AsyncLanes.Empty();
+	AsyncPipes.Reset();
 }
 
 UECFSubsystem* UECFSubsystem::Get(const UObject* WorldContextObject)
@@ -72,6 +192,14 @@ UECFSubsystem* UECFSubsystem::Get(const UObject* WorldContextObject)
 
 void UECFSubsystem::Tick(float DeltaTime)
 {
+	// Actions queued from other threads are created even when the subsystem is paused,
+	// the same way as actions added from the Game Thread.
+	CreateQueuedActions();
+
+	// Commands queued from other threads are applied after the queued actions are created,
+	// so they can control actions started from other threads too.
+	ApplyQueuedCommands();
+
 	// Do nothing when the whole subsystem is paused
 	if (bIsECFPaused)
 	{
@@ -86,352 +214,874 @@ void UECFSubsystem::Tick(float DeltaTime)
 	TRACE_CPUPROFILER_EVENT_SCOPE("ECF - Subsystem Tick");
 #endif
 
-	// Remove all expired actions first
-	Actions.RemoveAll([](UECFActionBase* Action) { return IsActionValid(Action) == false; });
+	// Wake up parked actions which async work has been done or which deadlines have passed.
+	// They are moved to pending actions, so they are ticked in this tick.
+	WakeCompletedActions(false);
+	AdvanceClocks();
+	UpdateTickLODs(DeltaTime);
 
-	// There might be a situation the pending action is invalid too
-	PendingAddActions.RemoveAll([&](UECFActionBase* PendingAddAction) { return IsActionValid(PendingAddAction) == false; });
+	// The game instance outlives worlds, so tick functions of used tick groups are registered in the current one.
+	for (int32 GroupIndex = 1; GroupIndex < TickGroupsNum; GroupIndex++)
+	{
+		if (TickGroups[GroupIndex].Actions.Num() > 0 || TickGroups[GroupIndex].PendingAddActions.Num() > 0)
+		{
+			RegisterTickFunction(static_cast<EECFTickGroup>(GroupIndex));
+		}
+	}
 
-	// Add all pending actions
-	Actions.Append(PendingAddActions);
-	PendingAddActions.Empty();
+	TickActions(TickGroups[static_cast<int32>(EECFTickGroup::Default)]);
 
 #if STATS
-	SET_DWORD_STAT(STAT_ECF_ActionsCount, Actions.Num());
-	SET_DWORD_STAT(STAT_ECF_InstancesCount, 0);
-#endif
+	int32 ActionsCount = 0;
+	int32 InstancesCount = 0;
+	for (const FECFTickGroupActions& TickGroupActions : TickGroups)
+	{
+		ActionsCount += TickGroupActions.ActionsNum;
+		InstancesCount += TickGroupActions.InstancesNum;
+	}
+	SET_DWORD_STAT(STAT_ECF_ActionsCount, ActionsCount);
+	SET_DWORD_STAT(STAT_ECF_InstancesCount, InstancesCount);
+	SET_DWORD_STAT(STAT_ECF_PrePhysicsActionsCount, TickGroups[static_cast<int32>(EECFTickGroup::PrePhysics)].ActionsNum);
+	SET_DWORD_STAT(STAT_ECF_PostPhysicsActionsCount, TickGroups[static_cast<int32>(EECFTickGroup::PostPhysics)].ActionsNum);
+	SET_DWORD_STAT(STAT_ECF_EndOfFrameActionsCount, TickGroups[static_cast<int32>(EECFTickGroup::EndOfFrame)].ActionsNum);
+	SET_DWORD_STAT(STAT_ECF_ParkedActionsCount, ParkedActions.Num());
 
-	// Tick all active actions
-	for (UECFActionBase* Action : Actions)
+	int32 AsyncTasksInFlight = 0;
+	int32 QueuedAsyncTasks = 0;
+	for (const TPair<FName, TSharedRef<FECFAsyncLane, ESPMode::ThreadSafe>>& AsyncLane : AsyncLanes)
 	{
-		if (IsActionValid(Action))
-		{
-#if STATS
-			if (Action->InstanceId.IsValid())
-			{
-				INC_DWORD_STAT(STAT_ECF_InstancesCount);
-			}
-#endif
-			Action->DoTick(DeltaTime);
-		}
+		const FECFAsyncLaneStats LaneStats = AsyncLane.Value->GetStats();
+		AsyncTasksInFlight += LaneStats.InFlight;
+		QueuedAsyncTasks += LaneStats.QueueDepth;
 	}
+	SET_DWORD_STAT(STAT_ECF_AsyncTasksInFlightCount, AsyncTasksInFlight);
+	SET_DWORD_STAT(STAT_ECF_QueuedAsyncTasksCount, QueuedAsyncTasks);
+	SET_DWORD_STAT(STAT_ECF_AsyncPipesCount, AsyncPipes.IsValid() ? AsyncPipes->Num() : 0);
+#endif
 }
 
-UECFActionBase* UECFSubsystem::FindAction(const FECFHandle& HandleId) const
+void UECFSubsystem::TickInGroup(EECFTickGroup Group)
 {
-	if (HandleId.IsValid())
+	// Do nothing when the whole subsystem is paused
+	if (bIsECFPaused)
 	{
-		if (UECFActionBase* const* ActionFound = Actions.FindByPredicate([&](UECFActionBase* Action) { return (IsActionValid(Action) && (Action->GetHandleId() == HandleId)); }))
-		{
-			return *ActionFound;
-		}
-		else if (UECFActionBase* const* PendingActionFound = PendingAddActions.FindByPredicate([&](UECFActionBase* PendingAddAction) { return (IsActionValid(PendingAddAction) && (PendingAddAction->GetHandleId() == HandleId)); }))
-		{
-			return *PendingActionFound;
-		}
+		return;
 	}
 
-#if ECF_LOGS
-	UE_LOG(LogECF, Error, TEXT("Couldn't find action of handle %s"), *HandleId.ToString());
+#if STATS
+	TStatId TickStatId;
+	switch (Group)
+	{
+		case EECFTickGroup::PrePhysics:
+			TickStatId = GET_STATID(STAT_ECF_TickPrePhysics);
+			break;
+		case EECFTickGroup::PostPhysics:
+			TickStatId = GET_STATID(STAT_ECF_TickPostPhysics);
+			break;
+		default:
+			TickStatId = GET_STATID(STAT_ECF_TickEndOfFrame);
+			break;
+	}
+	FScopeCycleCounter CycleCounter(TickStatId);
 #endif
 
-	return nullptr;
+#if ECF_INSIGHT_PROFILING
+	TRACE_CPUPROFILER_EVENT_SCOPE("ECF - Subsystem Tick Group");
+#endif
+
+	// Async work done since the last tick of any group is continued right away.
+	// The delta time of the tick function is dilated already, so clocks use the delta time of the frame instead.
+	WakeCompletedActions(false);
+	AdvanceClocks();
+
+	TickActions(TickGroups[static_cast<int32>(Group)]);
 }
 
-TArray<FECFHandle> UECFSubsystem::GetActionsHandlesByClass(TSubclassOf<UECFActionBase> Class) const
+void UECFSubsystem::TickActions(FECFTickGroupActions& TickGroupActions)
 {
-	TArray<FECFHandle> Result;
-	if (Class == nullptr)
+	TArray<UECFActionBase*>& Actions = TickGroupActions.Actions;
+
+	// Pending actions are merged at the beginning of the tick, so they are ticked in the same sweep.
+	// Actions added during the sweep (e.g. from other actions' callbacks) will wait until the next tick.
+	if (TickGroupActions.PendingAddActions.Num() > 0)
 	{
-		return Result;
+		Actions.Append(TickGroupActions.PendingAddActions);
+		TickGroupActions.PendingAddActions.Reset();
+	}
+
+	// With the tick budget set, the time of ticking actions is measured. Normal priority actions that don't fit
+	// into the budget are deferred to the next tick. Low priority actions are ticked after the sweep with the budget left.
+	// The budget is shared by all tick groups ticked in the same frame.
+	if (TickBudgetFrame != GFrameCounter)
+	{
+		TickBudgetFrame = GFrameCounter;
+		TickBudgetUsedCycles = 0;
+		DeferredActionsNum = 0;
+		ParallelTickedActionsNum = 0;
 	}
-	// Search in active actions
-	for (UECFActionBase* Action : Actions)
+	const bool bIsBudgeted = TickBudgetCycles > 0;
+	const uint64 StartCycles = bIsBudgeted ? FPlatformTime::Cycles64() - TickBudgetUsedCycles : 0;
+#if STATS
+	// The overrun stat is summed over all tick groups of the frame, so every group adds only the part it has caused.
+	const uint64 OverrunCyclesBefore = TickBudgetUsedCycles > TickBudgetCycles ? TickBudgetUsedCycles - TickBudgetCycles : 0;
+#endif
+	bool bIsBudgetExhausted = bIsBudgeted && TickBudgetUsedCycles >= TickBudgetCycles;
+	LowPriorityIndices.Reset();
+
+	// Tick all valid actions and compact out invalid and finished ones in a single sweep.
+	// Slots between KeptNum and the currently ticked action are cleared, so any query done
+	// from inside an action's callback never sees a removed or duplicated action.
+	// Parked actions are moved out to the parked actions list instead.
+	// Actions with immediate activation created during the sweep are appended to the list, so the number of actions
+	// is read every iteration. They have started in this tick, so they are ticked with zero delta time.
+	bIsTicking = true;
+	SweptGroupActions = &TickGroupActions;
+	ImmediateActivationsNum = 0;
+	int32 KeptNum = 0;
+#if STATS
+	int32 InstancesCount = 0;
+#endif
+	const int32 SweepStartNum = Actions.Num();
+	for (int32 Index = 0; Index < Actions.Num(); Index++)
 	{
-		if (IsActionValid(Action) && (Action->GetClass() == Class))
+		UECFActionBase* Action = Actions[Index];
+		if (IsActionValid(Action))
+		{
+			// Ticks can add new clocks, so the clock's state is copied.
+			const float DeltaTime = Clocks[Action->ClockIndex].DeltaTime;
+			const bool bIsClockStopped = Clocks[Action->ClockIndex].bIsStopped;
+			if (Action->bIsParked == false && bIsClockStopped == false)
+			{
+				if (Index >= SweepStartNum)
+				{
+					Action->DoDeferrableTick(0.f);
+				}
+				else if (Action->TickLODLevel > 0 && Action->ShouldTickLOD(GFrameCounter) == false)
+				{
+					Action->SkipLODTick(DeltaTime);
+				}
+				else if ((Action->Settings->bThreadSafeTick && Action->SupportsThreadSafeTick()) || (Action->Settings->bParallelCompute && Action->SupportsParallelCompute()))
+				{
+					// Ticked on worker threads after the sweep, so it doesn't use the tick budget.
+					FECFParallelTick& ParallelTick = ParallelTicks.AddDefaulted_GetRef();
+					ParallelTick.Action = Action;
+					ParallelTick.Owner = Action->Owner.Get();
+					ParallelTick.DeltaTime = DeltaTime;
+					ParallelTick.bComputeOnly = (Action->Settings->bThreadSafeTick && Action->SupportsThreadSafeTick()) == false;
+				}
+				else if (bIsBudgeted == false || Action->bIsTickDeferred || Action->Settings->TickPriority == EECFTickPriority::High)
+				{
+					Action->DoDeferrableTick(DeltaTime);
+					bIsBudgetExhausted = bIsBudgeted && FPlatformTime::Cycles64() - StartCycles >= TickBudgetCycles;
+				}
+				else if (Action->Settings->TickPriority == EECFTickPriority::Low)
+				{
+					// Not ticked yet, so it will be kept at this index.
+					LowPriorityIndices.Add(KeptNum);
+				}
+				else if (bIsBudgetExhausted)
+				{
+					Action->DeferTick(DeltaTime);
+					DeferredActionsNum++;
+				}
+				else
+				{
+					Action->DoDeferrableTick(DeltaTime);
+					bIsBudgetExhausted = FPlatformTime::Cycles64() - StartCycles >= TickBudgetCycles;
+				}
+			}
+
+			// The owner has been validated just before the tick, so checking the finish flag is enough.
+			if (Action->bHasFinished == false)
+			{
+				if (Action->bIsParked)
+				{
+					Action->ParkedIndex = ParkedActions.Add(Action);
+					Actions[Index] = nullptr;
+					continue;
+				}
+
+				if (KeptNum != Index)
+				{
+					Actions[KeptNum] = Action;
+					Actions[Index] = nullptr;
+				}
+				KeptNum++;
+#if STATS
+				if (Action->InstanceId.IsValid())
+				{
+					InstancesCount++;
+				}
+#endif
+				continue;
+			}
+		}
+		if (Action)
 		{
-			Result.Add(Action->GetHandleId());
+			if (Action->bOwnerLifetimeTracked)
+			{
+				UntrackOwnerLifetime(Action);
+			}
+			Action->Removed();
 		}
+		Actions[Index] = nullptr;
+	}
+	Actions.SetNum(KeptNum, ECF_NO_SHRINKING);
+	SweptGroupActions = nullptr;
+
+	// Thread safe actions finished here are removed from the list in the next sweep.
+	if (ParallelTicks.Num() > 0)
+	{
+		TickInParallel();
 	}
-	// Search in pending actions
-	for (UECFActionBase* PendingAction : PendingAddActions)
+
+	// Low priority actions finished or parked here are removed from the list in the next sweep.
+	for (const int32 LowPriorityIndex : LowPriorityIndices)
 	{
-		if (IsActionValid(PendingAction) && (PendingAction->GetClass() == Class))
+		UECFActionBase* Action = Actions[LowPriorityIndex];
+		if (IsActionValid(Action) && Action->bIsParked == false && Clocks[Action->ClockIndex].bIsStopped == false)
 		{
-			Result.Add(PendingAction->GetHandleId());
+			const float DeltaTime = Clocks[Action->ClockIndex].DeltaTime;
+			if (bIsBudgetExhausted)
+			{
+				Action->DeferTick(DeltaTime);
+				DeferredActionsNum++;
+			}
+			else
+			{
+				Action->DoDeferrableTick(DeltaTime);
+				bIsBudgetExhausted = FPlatformTime::Cycles64() - StartCycles >= TickBudgetCycles;
+			}
 		}
 	}
-	return Result;
+	bIsTicking = false;
+
+	if (bIsBudgeted)
+	{
+		TickBudgetUsedCycles = FPlatformTime::Cycles64() - StartCycles;
+	}
+
+	TickGroupActions.ActionsNum = KeptNum;
+#if STATS
+	TickGroupActions.InstancesNum = InstancesCount;
+
+	if (bIsBudgeted)
+	{
+		const uint64 OverrunCycles = TickBudgetUsedCycles > TickBudgetCycles ? TickBudgetUsedCycles - TickBudgetCycles : 0;
+		INC_FLOAT_STAT_BY(STAT_ECF_TickBudgetOverrun, static_cast<double>(OverrunCycles - OverrunCyclesBefore) * FPlatformTime::GetSecondsPerCycle64() * 1000.0);
+	}
+	SET_DWORD_STAT(STAT_ECF_DeferredActionsCount, DeferredActionsNum);
+	SET_DWORD_STAT(STAT_ECF_ParallelTickedActionsCount, ParallelTickedActionsNum);
+#endif
 }
 
-TArray<FECFHandle> UECFSubsystem::GetActionsHandlesByLabel(const FString& Label) const
+void UECFSubsystem::TickInParallel()
 {
-	TArray<FECFHandle> Result;
-	if (Label.IsEmpty())
+#if STATS
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("Parallel Tick"), STAT_ECF_ParallelTick, STATGROUP_ECF);
+#endif
+
+#if ECF_INSIGHT_PROFILING
+	TRACE_CPUPROFILER_EVENT_SCOPE("ECF - Parallel Tick");
+#endif
+
+	// Callbacks of actions ticked later in the sweep could stop collected actions or destroy their owners.
+	ParallelTicks.RemoveAll([this](const FECFParallelTick& ParallelTick)
 	{
-		return Result;
-	}
-	// Search in active actions
-	for (UECFActionBase* Action : Actions)
+		return IsActionValid(ParallelTick.Action) == false;
+	});
+
+	// Actions of the same owner form one partition, ticked on a single thread in the order of the sweep.
+	ParallelTickPartitions.Reset();
+	ParallelTickOwners.Reset();
+	for (int32 Index = 0; Index < ParallelTicks.Num(); Index++)
 	{
-		if (IsActionValid(Action) && (Action->Settings.Label == Label))
+		if (const int32* PartitionIndex = ParallelTickOwners.Find(ParallelTicks[Index].Owner))
+		{
+			FECFParallelTickPartition& Partition = ParallelTickPartitions[*PartitionIndex];
+			ParallelTicks[Partition.LastIndex].NextIndex = Index;
+			Partition.LastIndex = Index;
+		}
+		else
 		{
-			Result.Add(Action->GetHandleId());
+			ParallelTickOwners.Add(ParallelTicks[Index].Owner, ParallelTickPartitions.Add({ Index, Index }));
 		}
 	}
-	// Search in pending actions
-	for (UECFActionBase* PendingAction : PendingAddActions)
+
+	ParallelFor(ParallelTickPartitions.Num(), [this](int32 PartitionIndex)
+	{
+		for (int32 Index = ParallelTickPartitions[PartitionIndex].FirstIndex; Index != INDEX_NONE; Index = ParallelTicks[Index].NextIndex)
+		{
+			UECFActionBase* Action = ParallelTicks[Index].Action;
+			Action->bIsTickingInParallel = true;
+			Action->bIsComputingTick = ParallelTicks[Index].bComputeOnly;
+			Action->DoDeferrableTick(ParallelTicks[Index].DeltaTime);
+			Action->bIsComputingTick = false;
+			Action->bIsTickingInParallel = false;
+		}
+	});
+
+	// Computed states are applied and completion callbacks are run on the Game Thread, in the order of the sweep,
+	// because they can touch anything. Applying can stop actions applied later, so their validity is checked again.
+	for (const FECFParallelTick& ParallelTick : ParallelTicks)
 	{
-		if (IsActionValid(PendingAction) && (PendingAction->Settings.Label == Label))
+		if (ParallelTick.Action->bHasTickToApply)
+		{
+			ParallelTick.Action->bHasTickToApply = false;
+			if (IsActionValid(ParallelTick.Action))
+			{
+				ParallelTick.Action->ApplyTick();
+			}
+		}
+		if (ParallelTick.Action->bIsCompletionDeferred)
 		{
-			Result.Add(PendingAction->GetHandleId());
+			ParallelTick.Action->bIsCompletionDeferred = false;
+			ParallelTick.Action->Complete(false);
 		}
 	}
-	return Result;
-}
 
-TArray<UECFActionBase*> UECFSubsystem::GetAllActions() const
-{
-	TArray<UECFActionBase*> Result;
-	Result.Reserve(GetActionsCount());
-	Result.Append(Actions);
-	Result.Append(PendingAddActions);
-	return Result;
+	ParallelTickedActionsNum += ParallelTicks.Num();
+	ParallelTicks.Reset();
 }
 
-int32 UECFSubsystem::GetActionsCount() const
+void UECFSubsystem::AddPendingAction(UECFActionBase* Action)
 {
-	return Actions.Num() + PendingAddActions.Num();
-}
+	FECFTickGroupActions& TickGroupActions = GetTickGroupActions(Action);
 
-void UECFSubsystem::PauseAction(const FECFHandle& HandleId)
-{
-	if (UECFActionBase* ActionFound = FindAction(HandleId))
+	// Join the sweep of the action's tick group if it is in progress. The number of such actions is limited,
+	// so actions starting new actions in their first tick can't keep the sweep running forever.
+	if (Action->Settings->bActivateImmediately && SweptGroupActions == &TickGroupActions)
 	{
-#if (ECF_LOGS && ECF_LOGS_VERBOSE)
-		UE_LOG(LogECF, Verbose, TEXT("Paused Action of class: %s, Label: %s"), *ActionFound->GetName(), *ActionFound->GetLabel());
+		if (ImmediateActivationsNum < MaxImmediateActivationsPerSweep)
+		{
+			ImmediateActivationsNum++;
+			TickGroupActions.Actions.Add(Action);
+			return;
+		}
+#if ECF_LOGS
+		if (ImmediateActivationsNum++ == MaxImmediateActivationsPerSweep)
+		{
+			UE_LOG(LogECF, Warning, TEXT("Too many actions activated immediately in one tick. Action of class: %s, Label: %s will start in the next tick."), *Action->GetName(), *Action->GetLabel());
+		}
 #endif
-		ActionFound->bIsPaused = true;
 	}
-	else
+
+	TickGroupActions.PendingAddActions.Add(Action);
+	if (Action->Settings->TickGroup != EECFTickGroup::Default)
 	{
-#if ECF_LOGS
-		UE_LOG(LogECF, Error, TEXT("Can't find Action of id %s to pause"), *HandleId.ToString());
-#endif
+		RegisterTickFunction(Action->Settings->TickGroup);
 	}
 }
 
-void UECFSubsystem::ResumeAction(const FECFHandle& HandleId)
+void UECFSubsystem::RegisterTickFunction(EECFTickGroup Group)
 {
-	if (UECFActionBase* ActionFound = FindAction(HandleId))
+	UWorld* World = GetWorld();
+	if (Group == EECFTickGroup::Default || bCanTick == false || World == nullptr || World->PersistentLevel == nullptr)
 	{
-#if (ECF_LOGS && ECF_LOGS_VERBOSE)
-		UE_LOG(LogECF, Verbose, TEXT("Resume Action of class: %s, Label: %s"), *ActionFound->GetName(), *ActionFound->GetLabel());
-#endif
-		ActionFound->bIsPaused = false;
+		return;
 	}
-	else
+
+	// Tick functions are unregistered when their level is destroyed, so a registered tick function has a valid level.
+	FECFTickFunction& TickFunction = TickFunctions[static_cast<int32>(Group)];
+	if (TickFunction.IsTickFunctionRegistered())
 	{
-#if ECF_LOGS
-		UE_LOG(LogECF, Error, TEXT("Can't find Action of id %s to resume"), *HandleId.ToString());
-#endif
+		if (TickFunction.RegisteredLevel.Get() == World->PersistentLevel)
+		{
+			return;
+		}
+		TickFunction.UnRegisterTickFunction();
 	}
+
+	TickFunction.RegisterTickFunction(World->PersistentLevel);
+	TickFunction.RegisteredLevel = World->PersistentLevel;
 }
 
-bool UECFSubsystem::IsActionPaused(const FECFHandle& HandleId, bool& bIsPaused) const
+void UECFSubsystem::SetTickBudget(float InBudgetMs)
 {
-	if (UECFActionBase* ActionFound = FindAction(HandleId))
-	{
-		bIsPaused = ActionFound->bIsPaused;
-		return true;
-	}
-	return false;
+	TickBudgetMs = FMath::Max(InBudgetMs, 0.f);
+	TickBudgetCycles = TickBudgetMs > 0.f ? FMath::Max<uint64>(static_cast<uint64>(TickBudgetMs / (1000.0 * FPlatformTime::GetSecondsPerCycle64())), 1) : 0;
 }
 
-bool UECFSubsystem::ResetAction(const FECFHandle& HandleId, bool bCallUpdate)
+void UECFSubsystem::SpreadTickPhase(UECFActionBase* Action)
 {
-	if (UECFActionBase* ActionFound = FindAction(HandleId))
-	{
-		if (IsActionValid(ActionFound))
-		{
-#if (ECF_LOGS && ECF_LOGS_VERBOSE)
-			UE_LOG(LogECF, Verbose, TEXT("Reset Action of class: %s, Label: %s"), *ActionFound->GetName(), *ActionFound->GetLabel());
-#endif
-			return ActionFound->Reset(bCallUpdate);
-		}
-	}
+	const float TickInterval = Action->Settings->TickInterval;
 
-#if ECF_LOGS
-	UE_LOG(LogECF, Error, TEXT("Can't find Action of id %s to reset"), *HandleId.ToString());
-#endif
+	// Every next phase of the golden ratio sequence lands in the biggest gap left by the previous ones,
+	// so the ticks are balanced for any number of actions, no matter when they have been started.
+	uint32& Sequence = TickPhaseSequences.FindOrAdd(TickInterval);
+	const double SequencePhase = Sequence * 0.6180339887498949;
+	const double Phase = SequencePhase - FMath::FloorToDouble(SequencePhase);
+	Sequence++;
 
-	return false;
+	// Phases are placed on the grid of the action's clock, so actions started in different frames are balanced too.
+	const double Now = Clocks[Action->ClockIndex].Now;
+	const double FirstTickPhase = Phase - Now / TickInterval;
+	const double TimeToFirstTick = TickInterval * (FirstTickPhase - FMath::FloorToDouble(FirstTickPhase));
+
+	Action->bFirstTick = false;
+	Action->AccumulatedTime = TickInterval - TimeToFirstTick;
 }
 
-void UECFSubsystem::RemoveAction(FECFHandle& HandleId, bool bComplete)
+void UECFSubsystem::SetTickLODPolicy(const FECFTickLODPolicy& InPolicy)
 {
-	if (UECFActionBase* ActionFound = FindAction(HandleId))
-	{
-#if (ECF_LOGS && ECF_LOGS_VERBOSE)
-		UE_LOG(LogECF, Verbose, TEXT("Remove Action of class: %s, Label: %s"), *ActionFound->GetName(), *ActionFound->GetLabel());
-#endif
-		FinishAction(ActionFound, bComplete);
-		HandleId.Invalidate();
-	}
-	else
-	{
-#if ECF_LOGS
-		UE_LOG(LogECF, Error, TEXT("Can't find Action of id %s to remove"), *HandleId.ToString());
-#endif
-	}
+	TickLODPolicy = InPolicy;
+	TickLODUpdateTimeLeft = 0.f;
 }
 
-void UECFSubsystem::RemoveActionsOfClass(TSubclassOf<UECFActionBase> ActionClass, bool bComplete, UObject* InOwner)
+void UECFSubsystem::UpdateTickLODs(float DeltaTime)
 {
-	if (ActionClass == nullptr)
+	TickLODUpdateTimeLeft -= DeltaTime;
+	if (TickLODUpdateTimeLeft > 0.f)
 	{
-#if (ECF_LOGS && ECF_LOGS_VERBOSE)
-		UE_LOG(LogECF, Warning, TEXT("Trying to remove Actions of empty class!"));
-#endif
 		return;
 	}
+	TickLODUpdateTimeLeft = FMath::Max(TickLODPolicy.UpdateInterval, 0.f);
 
-#if (ECF_LOGS && ECF_LOGS_VERBOSE)
-	UE_LOG(LogECF, Verbose, TEXT("Removing Actions of class: %s"), *ActionClass->GetName());
+#if STATS
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("Update Tick LODs"), STAT_ECF_UpdateTickLODs, STATGROUP_ECF);
 #endif
 
-	// Find running actions of given class assigned to a specific owner (if specified) and set it as finished.
-	for (UECFActionBase* Action : Actions)
+	// Distances are measured to views of all local players.
+	TArray<FVector> ViewLocations;
+	if (!TickLODPolicy.GetLODLevel)
 	{
-		if (IsActionValid(Action))
+		if (UWorld* World = GetWorld())
 		{
-			if (Action->IsA(ActionClass))
+			for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
 			{
-				if (InOwner == nullptr || InOwner == Action->Owner)
+				APlayerController* PlayerController = It->Get();
+				if (PlayerController && PlayerController->IsLocalController())
 				{
-					FinishAction(Action, bComplete);
+					FVector ViewLocation;
+					FRotator ViewRotation;
+					PlayerController->GetPlayerViewPoint(ViewLocation, ViewRotation);
+					ViewLocations.Add(ViewLocation);
 				}
 			}
 		}
 	}
 
-	// Also check pending actions to prevent from launching it.
-	for (UECFActionBase* PendingAction : PendingAddActions)
+	// Many actions can share the same owner, so the level is computed once per owner.
+	TMap<const UObject*, int32> OwnersLODLevels;
+	ForEachActionsList([&](const TArray<UECFActionBase*>& ActionsList)
 	{
-		if (IsActionValid(PendingAction))
+		for (UECFActionBase* Action : ActionsList)
 		{
-			if (PendingAction->IsA(ActionClass))
+			if (IsActionValid(Action) && Action->Settings->bUseTickLOD)
 			{
-				if (InOwner == nullptr || InOwner == PendingAction->Owner)
+				const UObject* ActionOwner = Action->Owner.Get();
+				int32* LODLevel = OwnersLODLevels.Find(ActionOwner);
+				if (LODLevel == nullptr)
 				{
-					FinishAction(PendingAction, bComplete);
+					LODLevel = &OwnersLODLevels.Add(ActionOwner, GetTickLODLevel(ActionOwner, ViewLocations));
 				}
+				Action->TickLODLevel = static_cast<uint8>(*LODLevel);
 			}
 		}
-	}
+	});
 }
 
-void UECFSubsystem::RemoveActionsOfLabel(const FString& Label, bool bComplete, UObject* InOwner)
+int32 UECFSubsystem::GetTickLODLevel(const UObject* Owner, const TArray<FVector>& ViewLocations) const
 {
-	if (Label.IsEmpty())
+	int32 LODLevel = 0;
+	if (TickLODPolicy.GetLODLevel)
 	{
-#if (ECF_LOGS && ECF_LOGS_VERBOSE)
-		UE_LOG(LogECF, Warning, TEXT("Trying to remove Actions of Label, but Label is empty!"));
-#endif
-		return;
+		LODLevel = TickLODPolicy.GetLODLevel(Owner);
 	}
+	else if (ViewLocations.Num() > 0)
+	{
+		FVector OwnerLocation;
+		if (const AActor* OwnerActor = Cast<AActor>(Owner))
+		{
+			OwnerLocation = OwnerActor->GetActorLocation();
+		}
+		else if (const USceneComponent* OwnerSceneComponent = Cast<USceneComponent>(Owner))
+		{
+			OwnerLocation = OwnerSceneComponent->GetComponentLocation();
+		}
+		else if (const UActorComponent* OwnerComponent = Cast<UActorComponent>(Owner))
+		{
+			if (OwnerComponent->GetOwner() == nullptr)
+			{
+				return 0;
+			}
+			OwnerLocation = OwnerComponent->GetOwner()->GetActorLocation();
+		}
+		else
+		{
+			return 0;
+		}
 
-#if (ECF_LOGS && ECF_LOGS_VERBOSE)
-	UE_LOG(LogECF, Verbose, TEXT("Removing Actions of Label: %s"), *Label);
+		double MinDistanceSquared = TNumericLimits<double>::Max();
+		for (const FVector& ViewLocation : ViewLocations)
+		{
+			MinDistanceSquared = FMath::Min<double>(MinDistanceSquared, FVector::DistSquared(ViewLocation, OwnerLocation));
+		}
+		while (LODLevel < TickLODPolicy.Distances.Num() && MinDistanceSquared >= FMath::Square(static_cast<double>(TickLODPolicy.Distances[LODLevel])))
+		{
+			LODLevel++;
+		}
+	}
+	return FMath::Clamp(LODLevel, 0, FECFTickLODPolicy::MaxLODLevel);
+}
+
+void UECFSubsystem::CreateQueuedActions()
+{
+	TUniqueFunction<void()> QueuedAction;
+	while (QueuedActions.Dequeue(QueuedAction))
+	{
+		QueuedAction();
+	}
+}
+
+void UECFSubsystem::QueueCommands(FECFCommandBuffer&& Commands)
+{
+	if (Commands.IsEmpty() == false)
+	{
+		QueuedCommands.Enqueue(MoveTemp(Commands));
+	}
+}
+
+void UECFSubsystem::ApplyQueuedCommands()
+{
+	FECFCommandBuffer QueuedBuffer;
+	while (QueuedCommands.Dequeue(QueuedBuffer))
+	{
+		DequeuedCommands.Append(QueuedBuffer.GetCommands());
+	}
+
+	if (DequeuedCommands.Num() > 0)
+	{
+		ApplyCommands(DequeuedCommands);
+		DequeuedCommands.Reset();
+	}
+}
+
+void UECFSubsystem::ApplyCommands(TArrayView<const FECFActionCommand> Commands)
+{
+	check(IsInGameThread());
+
+#if STATS
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("Apply Commands"), STAT_ECF_ApplyCommands, STATGROUP_ECF);
 #endif
 
-	// Find running actions of given class assigned to a specific owner (if specified) and set it as finished.
-	for (UECFActionBase* Action : Actions)
+	// Resolve all handles with one pass over the actions lists instead of searching for every command.
+	TMap<FECFHandle, UECFActionBase*, TInlineSetAllocator<16>> CommandTargets;
+	for (const FECFActionCommand& Command : Commands)
 	{
-		if (IsActionValid(Action))
+		CommandTargets.Add(Command.Handle, nullptr);
+	}
+
+	int32 UnresolvedNum = CommandTargets.Num();
+	auto ResolveTargets = [&](const TArray<UECFActionBase*>& ActionsToSearch)
+	{
+		for (UECFActionBase* Action : ActionsToSearch)
 		{
-			if (Action->GetLabel() == Label)
+			if (UnresolvedNum == 0)
 			{
-				if (InOwner == nullptr || InOwner == Action->Owner)
+				return;
+			}
+			if (IsActionValid(Action))
+			{
+				if (UECFActionBase** CommandTarget = CommandTargets.Find(Action->GetHandleId()))
 				{
-					FinishAction(Action, bComplete);
+					*CommandTarget = Action;
+					UnresolvedNum--;
 				}
 			}
 		}
+	};
+	ForEachActionsList(ResolveTargets);
+
+	// Apply commands in order. Actions stopped by earlier commands are no longer valid for the later ones.
+	for (const FECFActionCommand& Command : Commands)
+	{
+		UECFActionBase* Action = CommandTargets.FindRef(Command.Handle);
+		if (IsActionValid(Action) == false)
+		{
+#if ECF_LOGS
+			UE_LOG(LogECF, Error, TEXT("Can't find Action of id %s to apply the command"), *Command.Handle.ToString());
+#endif
+			continue;
+		}
+
+#if (ECF_LOGS && ECF_LOGS_VERBOSE)
+		UE_LOG(LogECF, Verbose, TEXT("Apply command %d to Action of class: %s, Label: %s"), static_cast<int32>(Command.Command), *Action->GetName(), *Action->GetLabel());
+#endif
+
+		switch (Command.Command)
+		{
+			case EECFActionCommand::Stop:
+				FinishAction(Action, Command.bFlag);
+				break;
+			case EECFActionCommand::Pause:
+				SetActionPaused(Action, true);
+				break;
+			case EECFActionCommand::Resume:
+				SetActionPaused(Action, false);
+				break;
+			case EECFActionCommand::Reset:
+				Action->Reset(Command.bFlag);
+				break;
+			case EECFActionCommand::SetTime:
+				Action->SetActionTime(Command.Time, Command.bFlag);
+				break;
+		}
+	}
+}
+
+UECFActionBase* UECFSubsystem::FindAction(const FECFHandle& HandleId) const
+{
+	if (HandleId.IsValid())
+	{
+		if (UECFActionBase* ActionFound = FindActionIf([&](UECFActionBase* Action) { return (IsActionValid(Action) && (Action->GetHandleId() == HandleId)); }))
+		{
+			return ActionFound;
+		}
 	}
 
-	// Also check pending actions to prevent from launching it.
-	for (UECFActionBase* PendingAction : PendingAddActions)
+#if ECF_LOGS
+	UE_LOG(LogECF, Error, TEXT("Couldn't find action of handle %s"), *HandleId.ToString());
+#endif
+
+	return nullptr;
+}
+
+TArray<FECFHandle> UECFSubsystem::GetActionsHandlesByClass(TSubclassOf<UECFActionBase> Class) const
+{
+	TArray<FECFHandle> Result;
+	if (Class == nullptr)
+	{
+		return Result;
+	}
+	// Search in active, pending and parked actions of all tick groups
+	ForEachActionsList([&](const TArray<UECFActionBase*>& ActionsList)
 	{
-		if (IsActionValid(PendingAction))
+		for (UECFActionBase* Action : ActionsList)
 		{
-			if (PendingAction->GetLabel() == Label)
+			if (IsActionValid(Action) && (Action->GetClass() == Class))
 			{
-				if (InOwner == nullptr || InOwner == PendingAction->Owner)
-				{
-					FinishAction(PendingAction, bComplete);
-				}
+				Result.Add(Action->GetHandleId());
 			}
 		}
+	});
+	return Result;
+}
+
+TArray<FECFHandle> UECFSubsystem::GetActionsHandlesByLabel(const FString& Label) const
+{
+	TArray<FECFHandle> Result;
+	if (Label.IsEmpty())
+	{
+		return Result;
 	}
+	// Search in active, pending and parked actions of all tick groups
+	ForEachActionsList([&](const TArray<UECFActionBase*>& ActionsList)
+	{
+		for (UECFActionBase* Action : ActionsList)
+		{
+			if (IsActionValid(Action) && (Action->GetLabel() == Label))
+			{
+				Result.Add(Action->GetHandleId());
+			}
+		}
+	});
+	return Result;
 }
 
-void UECFSubsystem::RemoveInstancedAction(const FECFInstanceId& InstanceId, bool bComplete)
+TArray<UECFActionBase*> UECFSubsystem::GetAllActions() const
+{
+	TArray<UECFActionBase*> Result;
+	Result.Reserve(GetActionsCount());
+	ForEachActionsList([&](const TArray<UECFActionBase*>& ActionsList)
+	{
+		Result.Append(ActionsList);
+	});
+	return Result;
+}
+
+int32 UECFSubsystem::GetActionsCount() const
 {
+	int32 Result = 0;
+	ForEachActionsList([&](const TArray<UECFActionBase*>& ActionsList)
+	{
+		Result += ActionsList.Num();
+	});
+	return Result;
+}
+
+void UECFSubsystem::PauseAction(const FECFHandle& HandleId)
+{
+	if (UECFActionBase* ActionFound = FindAction(HandleId))
+	{
 #if (ECF_LOGS && ECF_LOGS_VERBOSE)
-	UE_LOG(LogECF, Verbose, TEXT("Removing Instanced Action of InstanceId: %s"), *InstanceId.ToString());
+		UE_LOG(LogECF, Verbose, TEXT("Paused Action of class: %s, Label: %s"), *ActionFound->GetName(), *ActionFound->GetLabel());
+#endif
+		SetActionPaused(ActionFound, true);
+	}
+	else
+	{
+#if ECF_LOGS
+		UE_LOG(LogECF, Error, TEXT("Can't find Action of id %s to pause"), *HandleId.ToString());
 #endif
+	}
+}
 
-	// Stop all running and pending actions with the given InstanceId.
-	for (UECFActionBase* Action : Actions)
+void UECFSubsystem::ResumeAction(const FECFHandle& HandleId)
+{
+	if (UECFActionBase* ActionFound = FindAction(HandleId))
 	{
-		if (IsActionValid(Action))
+#if (ECF_LOGS && ECF_LOGS_VERBOSE)
+		UE_LOG(LogECF, Verbose, TEXT("Resume Action of class: %s, Label: %s"), *ActionFound->GetName(), *ActionFound->GetLabel());
+#endif
+		SetActionPaused(ActionFound, false);
+	}
+	else
+	{
+#if ECF_LOGS
+		UE_LOG(LogECF, Error, TEXT("Can't find Action of id %s to resume"), *HandleId.ToString());
+#endif
+	}
+}
+
+bool UECFSubsystem::IsActionPaused(const FECFHandle& HandleId, bool& bIsPaused) const
+{
+	if (UECFActionBase* ActionFound = FindAction(HandleId))
+	{
+		bIsPaused = ActionFound->bIsPaused;
+		return true;
+	}
+	return false;
+}
+
+bool UECFSubsystem::ResetAction(const FECFHandle& HandleId, bool bCallUpdate)
+{
+	if (UECFActionBase* ActionFound = FindAction(HandleId))
+	{
+		if (IsActionValid(ActionFound))
+		{
+#if (ECF_LOGS && ECF_LOGS_VERBOSE)
+			UE_LOG(LogECF, Verbose, TEXT("Reset Action of class: %s, Label: %s"), *ActionFound->GetName(), *ActionFound->GetLabel());
+#endif
+			return ActionFound->Reset(bCallUpdate);
+		}
+	}
+
+#if ECF_LOGS
+	UE_LOG(LogECF, Error, TEXT("Can't find Action of id %s to reset"), *HandleId.ToString());
+#endif
+
+	return false;
+}
+
+void UECFSubsystem::RemoveAction(FECFHandle& HandleId, bool bComplete)
+{
+	if (UECFActionBase* ActionFound = FindAction(HandleId))
+	{
+#if (ECF_LOGS && ECF_LOGS_VERBOSE)
+		UE_LOG(LogECF, Verbose, TEXT("Remove Action of class: %s, Label: %s"), *ActionFound->GetName(), *ActionFound->GetLabel());
+#endif
+		FinishAction(ActionFound, bComplete);
+		HandleId.Invalidate();
+	}
+	else
+	{
+#if ECF_LOGS
+		UE_LOG(LogECF, Error, TEXT("Can't find Action of id %s to remove"), *HandleId.ToString());
+#endif
+	}
+}
+
+void UECFSubsystem::RemoveActionsOfClass(TSubclassOf<UECFActionBase> ActionClass, bool bComplete, UObject* InOwner)
+{
+	if (ActionClass == nullptr)
+	{
+#if (ECF_LOGS && ECF_LOGS_VERBOSE)
+		UE_LOG(LogECF, Warning, TEXT("Trying to remove Actions of empty class!"));
+#endif
+		return;
+	}
+
+#if (ECF_LOGS && ECF_LOGS_VERBOSE)
+	UE_LOG(LogECF, Verbose, TEXT("Removing Actions of class: %s"), *ActionClass->GetName());
+#endif
+
+	// Find running, pending and parked actions of given class assigned to a specific owner (if specified) and set them as finished.
+	ForEachActionsList([&](const TArray<UECFActionBase*>& ActionsList)
+	{
+		for (UECFActionBase* Action : ActionsList)
 		{
-			if (Action->HasInstanceId(InstanceId))
+			if (IsActionValid(Action) && Action->IsA(ActionClass) && (InOwner == nullptr || InOwner == Action->Owner))
 			{
 				FinishAction(Action, bComplete);
 			}
 		}
+	});
+}
+
+void UECFSubsystem::RemoveActionsOfLabel(const FString& Label, bool bComplete, UObject* InOwner)
+{
+	if (Label.IsEmpty())
+	{
+#if (ECF_LOGS && ECF_LOGS_VERBOSE)
+		UE_LOG(LogECF, Warning, TEXT("Trying to remove Actions of Label, but Label is empty!"));
+#endif
+		return;
 	}
-	for (UECFActionBase* PendingAction : PendingAddActions)
+
+#if (ECF_LOGS && ECF_LOGS_VERBOSE)
+	UE_LOG(LogECF, Verbose, TEXT("Removing Actions of Label: %s"), *Label);
+#endif
+
+	// Find running, pending and parked actions of given label assigned to a specific owner (if specified) and set them as finished.
+	ForEachActionsList([&](const TArray<UECFActionBase*>& ActionsList)
 	{
-		if (IsActionValid(PendingAction))
+		for (UECFActionBase* Action : ActionsList)
 		{
-			if (PendingAction->HasInstanceId(InstanceId))
+			if (IsActionValid(Action) && Action->GetLabel() == Label && (InOwner == nullptr || InOwner == Action->Owner))
 			{
-				FinishAction(PendingAction, bComplete);
+				FinishAction(Action, bComplete);
 			}
 		}
-	}
+	});
 }
 
-void UECFSubsystem::RemoveAllActions(bool bComplete, UObject* InOwner)
+void UECFSubsystem::RemoveInstancedAction(const FECFInstanceId& InstanceId, bool bComplete)
 {
 #if (ECF_LOGS && ECF_LOGS_VERBOSE)
-	UE_LOG(LogECF, Verbose, TEXT("Removing All Actions"));
+	UE_LOG(LogECF, Verbose, TEXT("Removing Instanced Action of InstanceId: %s"), *InstanceId.ToString());
 #endif
 
-	// Stop all running and pending actions.
-	for (UECFActionBase* Action : Actions)
+	// Stop all running, pending and parked actions with the given InstanceId.
+	ForEachActionsList([&](const TArray<UECFActionBase*>& ActionsList)
 	{
-		if (IsActionValid(Action))
+		for (UECFActionBase* Action : ActionsList)
 		{
-			if (InOwner == nullptr || InOwner == Action->Owner)
+			if (IsActionValid(Action) && Action->HasInstanceId(InstanceId))
 			{
 				FinishAction(Action, bComplete);
 			}
 		}
-	}
-	for (UECFActionBase* PendingAction : PendingAddActions)
+	});
+}
+
+void UECFSubsystem::RemoveAllActions(bool bComplete, UObject* InOwner)
+{
+#if (ECF_LOGS && ECF_LOGS_VERBOSE)
+	UE_LOG(LogECF, Verbose, TEXT("Removing All Actions"));
+#endif
+
+	// Stop all running, pending and parked actions.
+	ForEachActionsList([&](const TArray<UECFActionBase*>& ActionsList)
 	{
-		if (IsActionValid(PendingAction))
+		for (UECFActionBase* Action : ActionsList)
 		{
-			if (InOwner == nullptr || InOwner == PendingAction->Owner)
+			if (IsActionValid(Action) && (InOwner == nullptr || InOwner == Action->Owner))
 			{
-				FinishAction(PendingAction, bComplete);
+				FinishAction(Action, bComplete);
 			}
 		}
-	}
+	});
 }
 
 float UECFSubsystem::GetActionTime(const FECFHandle& HandleId)
@@ -449,6 +1099,21 @@ float UECFSubsystem::GetActionTime(const FECFHandle& HandleId)
 	}
 }
 
+float UECFSubsystem::GetActionProgress(const FECFHandle& HandleId)
+{
+	if (UECFActionBase* ActionFound = FindAction(HandleId))
+	{
+		return ActionFound->GetActionProgress();
+	}
+	else
+	{
+#if ECF_LOGS
+		UE_LOG(LogECF, Error, TEXT("GetActionProgress can't be called, because of action that can't be found. Id: %s"), *HandleId.ToString());
+#endif
+		return -1.f;
+	}
+}
+
 bool UECFSubsystem::SetActionTime(const FECFHandle& HandleId, float NewTime, bool bCallUpdate)
 {
 	if (UECFActionBase* ActionFound = FindAction(HandleId))
@@ -477,13 +1142,9 @@ UECFActionBase* UECFSubsystem::GetInstancedAction(const FECFInstanceId& Instance
 {
 	if (InstanceId.IsValid())
 	{
-		if (UECFActionBase* const* ActionFound = Actions.FindByPredicate([&](UECFActionBase* Action) { return IsActionValid(Action) && Action->HasInstanceId(InstanceId); }))
-		{
-			return *ActionFound;
-		}
-		else if (UECFActionBase* const* PendingActionFound = PendingAddActions.FindByPredicate([&](UECFActionBase* PendingAction) { return IsActionValid(PendingAction) && PendingAction->HasInstanceId(InstanceId); }))
+		if (UECFActionBase* ActionFound = FindActionIf([&](UECFActionBase* Action) { return IsActionValid(Action) && Action->HasInstanceId(InstanceId); }))
 		{
-			return *PendingActionFound;
+			return ActionFound;
 		}
 	}
 
@@ -506,6 +1167,12 @@ void UECFSubsystem::FinishAction(UECFActionBase* Action, bool bComplete)
 		{
 			Action->Complete(true);
 		}
+
+		// Finished parked action must be woken up, so it can be removed.
+		if (Action->bIsParked)
+		{
+			RequestWakeAction(Action);
+		}
 	}
 }
 
@@ -514,4 +1181,469 @@ bool UECFSubsystem::IsActionValid(UECFActionBase* Action)
 	return IsValid(Action) && (Action->HasAnyFlags(RF_BeginDestroyed | RF_FinishDestroyed) == false) && Action->IsValid();
 }
 
+void UECFSubsystem::ParkAction(UECFActionBase* Action, float InDeadlineTime)
+{
+#if (ECF_LOGS && ECF_LOGS_VERBOSE)
+	UE_LOG(LogECF, Verbose, TEXT("Park Action of class: %s, Label: %s, Deadline: %f"), *Action->GetName(), *Action->GetLabel(), InDeadlineTime);
+#endif
+
+	// Changing the serial makes the previous deadline outdated.
+	Action->bIsParked = true;
+	Action->DeadlineSerial++;
+	Action->ParkTimeLeft = FMath::Max(InDeadlineTime, 0.f);
+
+	// Paused action will schedule its deadline when it is resumed.
+	if (Action->ParkTimeLeft > 0.f && Action->bIsPaused == false)
+	{
+		ScheduleDeadline(Action);
+	}
+}
+
+void UECFSubsystem::WakeAction(UECFActionBase* Action)
+{
+	Action->bIsParked = false;
+	Action->DeadlineSerial++;
+	Action->ParkTimeLeft = 0.f;
+
+	// If the action has been already moved to parked list, move it back to pending actions.
+	// Otherwise it is still in one of the ticked lists.
+	if (Action->ParkedIndex != INDEX_NONE)
+	{
+		const int32 ParkedIndex = Action->ParkedIndex;
+		ParkedActions.RemoveAtSwap(ParkedIndex, 1, ECF_NO_SHRINKING);
+		if (ParkedActions.IsValidIndex(ParkedIndex) && ParkedActions[ParkedIndex])
+		{
+			ParkedActions[ParkedIndex]->ParkedIndex = ParkedIndex;
+		}
+		Action->ParkedIndex = INDEX_NONE;
+		AddPendingAction(Action);
+	}
+}
+
+void UECFSubsystem::RequestWakeAction(UECFActionBase* Action)
+{
+	if (CompletionQueue.IsValid())
+	{
+		CompletionQueue->Enqueue(Action);
+	}
+}
+
+void UECFSubsystem::WakeCompletedActions(bool bTickImmediateContinuations)
+{
+	// Immediate continuations requested during the tick will be handled at the beginning of the next one.
+	if (bTickImmediateContinuations && bIsTicking)
+	{
+		return;
+	}
+
+	// Game Thread tasks of late signals can run after the subsystem has been deinitialized.
+	if (CompletionQueue.IsValid() == false)
+	{
+		return;
+	}
+
+	TWeakObjectPtr<UECFActionBase> CompletedAction;
+	while (CompletionQueue->Dequeue(CompletedAction))
+	{
+		UECFActionBase* Action = CompletedAction.Get();
+		if (Action && Action->bIsParked)
+		{
+			WakeAction(Action);
+
+			// Continue the action right away, without waiting for the next tick.
+			if (bTickImmediateContinuations && Action->Settings->bImmediateContinuation && bIsECFPaused == false && Clocks[Action->ClockIndex].bIsStopped == false && IsActionValid(Action))
+			{
+				Action->DoTick(0.f);
+			}
+		}
+	}
+}
+
+void UECFSubsystem::ScheduleDeadline(UECFActionBase* Action)
+{
+	FECFClock& Clock = Clocks[Action->ClockIndex];
+	Action->ParkDeadline = Clock.Now + Action->ParkTimeLeft;
+
+	FECFDeadline Deadline;
+	Deadline.Time = Action->ParkDeadline;
+	Deadline.Action = Action;
+	Deadline.Serial = Action->DeadlineSerial;
+	Clock.Deadlines.HeapPush(Deadline);
+}
+
+void UECFSubsystem::AdvanceClocks()
+{
+	if (ClocksFrame == GFrameCounter)
+	{
+		return;
+	}
+	ClocksFrame = GFrameCounter;
+
+	// Pause and time dilation are resolved once per frame for all clocks.
+	FECFClockContext Context;
+	Context.World = GetWorld();
+	Context.DeltaTime = FApp::GetDeltaTime();
+	if (Context.World)
+	{
+		Context.bIsWorldPaused = Context.World->IsPaused();
+		if (AWorldSettings* WorldSettings = Context.World->GetWorldSettings())
+		{
+			Context.TimeDilation = WorldSettings->TimeDilation;
+		}
+	}
+
+	// Clocks are accessed by index, because actions woken up here can add new custom clocks.
+	for (int32 ClockIndex = 0; ClockIndex < Clocks.Num(); ClockIndex++)
+	{
+		float DeltaTime = 0.f;
+		if (ClockIndex < BuiltInClocksNum)
+		{
+			const bool bIgnorePause = (ClockIndex & 1) != 0;
+			const bool bIgnoreGlobalTimeDilation = (ClockIndex & 2) != 0;
+			if (Context.bIsWorldPaused == false || bIgnorePause)
+			{
+				DeltaTime = bIgnoreGlobalTimeDilation ? Context.DeltaTime : Context.DeltaTime * Context.TimeDilation;
+				Clocks[ClockIndex].bIsStopped = false;
+			}
+			else
+			{
+				Clocks[ClockIndex].bIsStopped = true;
+			}
+		}
+		else if (Clocks[ClockIndex].ParentIndex != INDEX_NONE)
+		{
+			// Parent clocks are always added before their action group clocks, so they have been already advanced.
+			const FECFClock& ParentClock = Clocks[Clocks[ClockIndex].ParentIndex];
+			const FECFActionGroup& ActionGroup = ActionGroups[Clocks[ClockIndex].ActionGroupIndex];
+			if (ParentClock.bIsStopped == false && ActionGroup.bIsPaused == false && ActionGroup.TimeDilation > 0.f)
+			{
+				DeltaTime = ParentClock.DeltaTime * ActionGroup.TimeDilation;
+				Clocks[ClockIndex].bIsStopped = false;
+			}
+			else
+			{
+				Clocks[ClockIndex].bIsStopped = true;
+			}
+		}
+		else
+		{
+			DeltaTime = Clocks[ClockIndex].Source.IsValid() ? FMath::Max(Clocks[ClockIndex].Source->Advance(Context), 0.f) : 0.f;
+			Clocks[ClockIndex].bIsStopped = DeltaTime <= 0.f;
+		}
+
+		Clocks[ClockIndex].DeltaTime = DeltaTime;
+		if (Clocks[ClockIndex].bIsStopped)
+		{
+			continue;
+		}
+		Clocks[ClockIndex].Now += DeltaTime;
+
+		while (Clocks[ClockIndex].Deadlines.Num() > 0 && Clocks[ClockIndex].Deadlines.HeapTop().Time <= Clocks[ClockIndex].Now)
+		{
+			FECFDeadline Deadline;
+			Clocks[ClockIndex].Deadlines.HeapPop(Deadline, ECF_NO_SHRINKING);
+
+			UECFActionBase* Action = Deadline.Action.Get();
+			if (Action && Action->bIsParked && Action->DeadlineSerial == Deadline.Serial && IsActionValid(Action))
+			{
+				WakeAction(Action);
+				Action->DeadlineReached();
+			}
+		}
+	}
+}
+
+int32 UECFSubsystem::GetClockIndex(const FECFActionSettings* InSettings)
+{
+	int32 ClockIndex = INDEX_NONE;
+	if (InSettings->Clock.IsNone())
+	{
+		ClockIndex = (InSettings->bIgnorePause ? 1 : 0) | (InSettings->bIgnoreGlobalTimeDilation ? 2 : 0);
+	}
+	else if (const int32* CustomClockIndex = CustomClockIndices.Find(InSettings->Clock))
+	{
+		ClockIndex = *CustomClockIndex;
+	}
+	else
+	{
+#if ECF_LOGS
+		UE_LOG(LogECF, Warning, TEXT("ECF - clock %s is not registered. Actions using it won't run until it is registered."), *InSettings->Clock.ToString());
+#endif
+		ClockIndex = Clocks.AddDefaulted();
+		CustomClockIndices.Add(InSettings->Clock, ClockIndex);
+	}
+
+	// Actions of an action group use the clock derived from the one they would use without the group.
+	if (InSettings->ActionGroup.IsNone() == false)
+	{
+		const int32 ActionGroupIndex = GetActionGroupIndex(InSettings->ActionGroup);
+		const TPair<int32, int32> ActionGroupClockKey(ClockIndex, ActionGroupIndex);
+		if (const int32* ActionGroupClockIndex = ActionGroupClockIndices.Find(ActionGroupClockKey))
+		{
+			return *ActionGroupClockIndex;
+		}
+
+		const int32 ParentIndex = ClockIndex;
+		ClockIndex = Clocks.AddDefaulted();
+		Clocks[ClockIndex].ParentIndex = ParentIndex;
+		Clocks[ClockIndex].ActionGroupIndex = ActionGroupIndex;
+		ActionGroupClockIndices.Add(ActionGroupClockKey, ClockIndex);
+	}
+
+	return ClockIndex;
+}
+
+int32 UECFSubsystem::GetActionGroupIndex(FName ActionGroupName)
+{
+	if (const int32* ActionGroupIndex = ActionGroupIndices.Find(ActionGroupName))
+	{
+		return *ActionGroupIndex;
+	}
+	const int32 ActionGroupIndex = ActionGroups.AddDefaulted();
+	ActionGroupIndices.Add(ActionGroupName, ActionGroupIndex);
+	return ActionGroupIndex;
+}
+
+void UECFSubsystem::SetActionGroupPaused(FName ActionGroupName, bool bPaused)
+{
+	if (ActionGroupName.IsNone() == false)
+	{
+		ActionGroups[GetActionGroupIndex(ActionGroupName)].bIsPaused = bPaused;
+	}
+}
+
+bool UECFSubsystem::IsActionGroupPaused(FName ActionGroupName) const
+{
+	if (const int32* ActionGroupIndex = ActionGroupIndices.Find(ActionGroupName))
+	{
+		return ActionGroups[*ActionGroupIndex].bIsPaused;
+	}
+	return false;
+}
+
+void UECFSubsystem::SetActionGroupTimeDilation(FName ActionGroupName, float TimeDilation)
+{
+	if (ActionGroupName.IsNone() == false)
+	{
+		ActionGroups[GetActionGroupIndex(ActionGroupName)].TimeDilation = FMath::Max(TimeDilation, 0.f);
+	}
+}
+
+float UECFSubsystem::GetActionGroupTimeDilation(FName ActionGroupName) const
+{
+	if (const int32* ActionGroupIndex = ActionGroupIndices.Find(ActionGroupName))
+	{
+		return ActionGroups[*ActionGroupIndex].TimeDilation;
+	}
+	return 1.f;
+}
+
+void UECFSubsystem::RegisterClock(FName ClockName, const TSharedRef<FECFClockSource>& Source)
+{
+	if (ClockName.IsNone())
+	{
+#if ECF_LOGS
+		UE_LOG(LogECF, Error, TEXT("ECF - trying to register a clock without a name!"));
+#endif
+		return;
+	}
+
+	int32 ClockIndex = INDEX_NONE;
+	if (const int32* ClockIndexFound = CustomClockIndices.Find(ClockName))
+	{
+		ClockIndex = *ClockIndexFound;
+	}
+	else
+	{
+		ClockIndex = Clocks.AddDefaulted();
+		CustomClockIndices.Add(ClockName, ClockIndex);
+	}
+	Clocks[ClockIndex].Source = Source;
+}
+
+void UECFSubsystem::UnregisterClock(FName ClockName)
+{
+	if (const int32* ClockIndex = CustomClockIndices.Find(ClockName))
+	{
+		Clocks[*ClockIndex].Source.Reset();
+		Clocks[*ClockIndex].bIsStopped = true;
+		Clocks[*ClockIndex].DeltaTime = 0.f;
+	}
+}
+
+void UECFSubsystem::SetActionPaused(UECFActionBase* Action, bool bPaused)
+{
+	if (Action->bIsPaused == bPaused)
+	{
+		return;
+	}
+	Action->bIsPaused = bPaused;
+
+	// Freeze the time left to the deadline of paused parked action and schedule it again when resumed.
+	if (Action->bIsParked && Action->ParkTimeLeft > 0.f)
+	{
+		if (bPaused)
+		{
+			const FECFClock& Clock = Clocks[Action->ClockIndex];
+			Action->ParkTimeLeft = FMath::Max(static_cast<float>(Action->ParkDeadline - Clock.Now), KINDA_SMALL_NUMBER);
+			Action->DeadlineSerial++;
+		}
+		else
+		{
+			ScheduleDeadline(Action);
+		}
+	}
+}
+
+TSharedRef<FECFAsyncLane, ESPMode::ThreadSafe> UECFSubsystem::GetAsyncLane(FName LaneName)
+{
+	if (TSharedRef<FECFAsyncLane, ESPMode::ThreadSafe>* AsyncLane = AsyncLanes.Find(LaneName))
+	{
+		return *AsyncLane;
+	}
+
+#if (ECF_LOGS && ECF_LOGS_VERBOSE)
+	UE_LOG(LogECF, Log, TEXT("Creating async lane %s allowing one task at once"), *LaneName.ToString());
+#endif
+
+	return AsyncLanes.Add(LaneName, MakeShared<FECFAsyncLane, ESPMode::ThreadSafe>(1));
+}
+
+void UECFSubsystem::SetAsyncLaneMaxInFlight(FName LaneName, int32 MaxInFlight)
+{
+	if (TSharedRef<FECFAsyncLane, ESPMode::ThreadSafe>* AsyncLane = AsyncLanes.Find(LaneName))
+	{
+		(*AsyncLane)->SetMaxInFlight(MaxInFlight);
+	}
+	else
+	{
+		AsyncLanes.Add(LaneName, MakeShared<FECFAsyncLane, ESPMode::ThreadSafe>(MaxInFlight));
+	}
+}
+
+bool UECFSubsystem::GetAsyncLaneStats(FName LaneName, FECFAsyncLaneStats& OutStats) const
+{
+	if (const TSharedRef<FECFAsyncLane, ESPMode::ThreadSafe>* AsyncLane = AsyncLanes.Find(LaneName))
+	{
+		OutStats = (*AsyncLane)->GetStats();
+		return true;
+	}
+	return false;
+}
+
+void UECFSubsystem::TrackOwnerLifetime(UECFActionBase* Action)
+{
+	const UObject* ActionOwner = Action->Owner.Get();
+	if (ActionOwner == nullptr)
+	{
+		// Nothing to track. Invalid owner will be detected by the regular validation.
+		return;
+	}
+
+	FECFTrackedOwner& TrackedOwner = TrackedOwners.FindOrAdd(FObjectKey(ActionOwner));
+	if (TrackedOwner.Owner.IsValid() == false)
+	{
+		TrackedOwner.Owner = ActionOwner;
+
+		// Actors can be destroyed long before they are garbage collected, so listen to their destruction directly.
+		if (AActor* OwnerActor = Cast<AActor>(const_cast<UObject*>(ActionOwner)))
+		{
+			OwnerActor->OnDestroyed.AddUniqueDynamic(this, &UECFSubsystem::OnTrackedActorDestroyed);
+			OwnerActor->OnEndPlay.AddUniqueDynamic(this, &UECFSubsystem::OnTrackedActorEndPlay);
+			TrackedOwner.bIsBoundToActor = true;
+		}
+	}
+
+	TrackedOwner.Actions.Add(Action);
+	Action->bOwnerLifetimeTracked = true;
+}
+
+void UECFSubsystem::UntrackOwnerLifetime(UECFActionBase* Action)
+{
+	Action->bOwnerLifetimeTracked = false;
+
+	const FObjectKey OwnerKey(Action->Owner.GetEvenIfUnreachable());
+	if (FECFTrackedOwner* TrackedOwner = TrackedOwners.Find(OwnerKey))
+	{
+		TrackedOwner->Actions.RemoveSingleSwap(Action);
+		if (TrackedOwner->Actions.Num() == 0)
+		{
+			if (TrackedOwner->bIsBoundToActor)
+			{
+				if (AActor* OwnerActor = Cast<AActor>(const_cast<UObject*>(TrackedOwner->Owner.Get())))
+				{
+					OwnerActor->OnDestroyed.RemoveDynamic(this, &UECFSubsystem::OnTrackedActorDestroyed);
+					OwnerActor->OnEndPlay.RemoveDynamic(this, &UECFSubsystem::OnTrackedActorEndPlay);
+				}
+			}
+			TrackedOwners.Remove(OwnerKey);
+		}
+	}
+}
+
+void UECFSubsystem::InvalidateOwnerActions(const FObjectKey& OwnerKey)
+{
+	FECFTrackedOwner TrackedOwner;
+	if (TrackedOwners.RemoveAndCopyValue(OwnerKey, TrackedOwner) == false)
+	{
+		return;
+	}
+
+#if (ECF_LOGS && ECF_LOGS_VERBOSE)
+	UE_LOG(LogECF, Verbose, TEXT("Tracked owner died, invalidating %d Actions"), TrackedOwner.Actions.Num());
+#endif
+
+	// The owner is dead, so its actions must be validated regularly from now on (which will fail).
+	for (const TWeakObjectPtr<UECFActionBase>& WeakAction : TrackedOwner.Actions)
+	{
+		if (UECFActionBase* Action = WeakAction.Get())
+		{
+			Action->bOwnerLifetimeTracked = false;
+			Action->MarkAsFinished();
+			if (Action->bIsParked)
+			{
+				RequestWakeAction(Action);
+			}
+		}
+	}
+}
+
+void UECFSubsystem::OnPostGarbageCollect()
+{
+	// Owners which are not Actors die only when they are garbage collected, so validating them once
+	// per garbage collection is enough. Actors are validated here too, in case they were collected without being destroyed.
+	TArray<FObjectKey, TInlineAllocator<16>> DeadOwners;
+	for (const TPair<FObjectKey, FECFTrackedOwner>& TrackedOwner : TrackedOwners)
+	{
+		const UObject* TrackedOwnerObject = TrackedOwner.Value.Owner.Get();
+		if (TrackedOwnerObject == nullptr || TrackedOwnerObject->HasAnyFlags(RF_BeginDestroyed | RF_FinishDestroyed))
+		{
+			DeadOwners.Add(TrackedOwner.Key);
+		}
+	}
+	for (const FObjectKey& DeadOwner : DeadOwners)
+	{
+		InvalidateOwnerActions(DeadOwner);
+	}
+
+	// Parked actions are not validated every tick, so wake up the ones which lost their owners to remove them.
+	for (UECFActionBase* ParkedAction : ParkedActions)
+	{
+		if (ParkedAction && ParkedAction->bIsParked && IsActionValid(ParkedAction) == false)
+		{
+			RequestWakeAction(ParkedAction);
+		}
+	}
+}
+
+void UECFSubsystem::OnTrackedActorDestroyed(AActor* DestroyedActor)
+{
+	InvalidateOwnerActions(FObjectKey(DestroyedActor));
+}
+
+void UECFSubsystem::OnTrackedActorEndPlay(AActor* Actor, EEndPlayReason::Type EndPlayReason)
+{
+	InvalidateOwnerActions(FObjectKey(Actor));
+}
+
 ECF_PRAGMA_ENABLE_OPTIMIZATION
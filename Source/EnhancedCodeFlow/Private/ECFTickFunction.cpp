@@ -0,0 +1,21 @@
+// Copyright (c) 2026 Damian Nowakowski. All rights reserved.
+
+#include "ECFTickFunction.h"
+#include "ECFSubsystem.h"
+
+ECF_PRAGMA_DISABLE_OPTIMIZATION
+
+void FECFTickFunction::ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+{
+	if (Subsystem)
+	{
+		Subsystem->TickInGroup(Group);
+	}
+}
+
+FString FECFTickFunction::DiagnosticMessage()
+{
+	return FString::Printf(TEXT("ECF Tick Group %d"), static_cast<int32>(Group));
+}
+
+ECF_PRAGMA_ENABLE_OPTIMIZATION
\ No newline at end of file
@@ -112,6 +112,98 @@ bool FEnhancedCodeFlow::GetPause(const UObject* WorldContextObject)
 		return false;
 }
 
+void FEnhancedCodeFlow::PauseActionGroup(const UObject* WorldContextObject, FName ActionGroupName)
+{
+	if (UECFSubsystem* ECF = UECFSubsystem::Get(WorldContextObject))
+		ECF->SetActionGroupPaused(ActionGroupName, true);
+}
+
+void FEnhancedCodeFlow::ResumeActionGroup(const UObject* WorldContextObject, FName ActionGroupName)
+{
+	if (UECFSubsystem* ECF = UECFSubsystem::Get(WorldContextObject))
+		ECF->SetActionGroupPaused(ActionGroupName, false);
+}
+
+bool FEnhancedCodeFlow::IsActionGroupPaused(const UObject* WorldContextObject, FName ActionGroupName)
+{
+	if (UECFSubsystem* ECF = UECFSubsystem::Get(WorldContextObject))
+		return ECF->IsActionGroupPaused(ActionGroupName);
+	else
+		return false;
+}
+
+void FEnhancedCodeFlow::SetActionGroupTimeDilation(const UObject* WorldContextObject, FName ActionGroupName, float TimeDilation)
+{
+	if (UECFSubsystem* ECF = UECFSubsystem::Get(WorldContextObject))
+		ECF->SetActionGroupTimeDilation(ActionGroupName, TimeDilation);
+}
+
+float FEnhancedCodeFlow::GetActionGroupTimeDilation(const UObject* WorldContextObject, FName ActionGroupName)
+{
+	if (UECFSubsystem* ECF = UECFSubsystem::Get(WorldContextObject))
+		return ECF->GetActionGroupTimeDilation(ActionGroupName);
+	else
+		return 1.f;
+}
+
+void FEnhancedCodeFlow::SetTickLODPolicy(const UObject* WorldContextObject, const FECFTickLODPolicy& Policy)
+{
+	if (UECFSubsystem* ECF = UECFSubsystem::Get(WorldContextObject))
+		ECF->SetTickLODPolicy(Policy);
+}
+
+void FEnhancedCodeFlow::QueueCommands(const UObject* WorldContextObject, FECFCommandBuffer Commands)
+{
+	if (UECFSubsystem* ECF = UECFSubsystem::Get(WorldContextObject))
+		ECF->QueueCommands(MoveTemp(Commands));
+}
+
+void FEnhancedCodeFlow::ApplyCommands(const UObject* WorldContextObject, const FECFCommandBuffer& Commands)
+{
+	if (UECFSubsystem* ECF = UECFSubsystem::Get(WorldContextObject))
+		ECF->ApplyCommands(Commands.GetCommands());
+}
+
+void FEnhancedCodeFlow::SetAsyncLaneMaxInFlight(const UObject* WorldContextObject, FName LaneName, int32 MaxInFlight)
+{
+	if (UECFSubsystem* ECF = UECFSubsystem::Get(WorldContextObject))
+		ECF->SetAsyncLaneMaxInFlight(LaneName, MaxInFlight);
+}
+
+bool FEnhancedCodeFlow::GetAsyncLaneStats(const UObject* WorldContextObject, FName LaneName, FECFAsyncLaneStats& OutStats)
+{
+	if (UECFSubsystem* ECF = UECFSubsystem::Get(WorldContextObject))
+		return ECF->GetAsyncLaneStats(LaneName, OutStats);
+	else
+		return false;
+}
+
+void FEnhancedCodeFlow::SetTickBudget(const UObject* WorldContextObject, float InBudgetMs)
+{
+	if (UECFSubsystem* ECF = UECFSubsystem::Get(WorldContextObject))
+		ECF->SetTickBudget(InBudgetMs);
+}
+
+float FEnhancedCodeFlow::GetTickBudget(const UObject* WorldContextObject)
+{
+	if (UECFSubsystem* ECF = UECFSubsystem::Get(WorldContextObject))
+		return ECF->GetTickBudget();
+	else
+		return 0.f;
+}
+
+void FEnhancedCodeFlow::RegisterClock(const UObject* WorldContextObject, FName ClockName, const TSharedRef<FECFClockSource>& Clock)
+{
+	if (UECFSubsystem* ECF = UECFSubsystem::Get(WorldContextObject))
+		ECF->RegisterClock(ClockName, Clock);
+}
+
+void FEnhancedCodeFlow::UnregisterClock(const UObject* WorldContextObject, FName ClockName)
+{
+	if (UECFSubsystem* ECF = UECFSubsystem::Get(WorldContextObject))
+		ECF->UnregisterClock(ClockName);
+}
+
 /*^^^ Stop ECF Functions ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^*/
 
 void FFlow::StopAction(const UObject* WorldContextObject, FECFHandle& Handle, bool bComplete/* = false*/)
@@ -153,6 +245,13 @@ float FFlow::GetActionTime(const UObject* WorldContextObject, const FECFHandle&
 	return -1.f;
 }
 
+float FFlow::GetActionProgress(const UObject* WorldContextObject, const FECFHandle& Handle)
+{
+	if (UECFSubsystem* ECF = UECFSubsystem::Get(WorldContextObject))
+		return ECF->GetActionProgress(Handle);
+	return -1.f;
+}
+
 bool FFlow::SetActionTime(const UObject* WorldContextObject, const FECFHandle& Handle, float NewTime, bool bCallUpdate)
 {
 	if (UECFSubsystem* ECF = UECFSubsystem::Get(WorldContextObject))
@@ -357,6 +456,24 @@ void FFlow::RemoveAllWhileTrueExecutes(const UObject* WorldContextObject, bool b
 		ECF->RemoveActionsOfClass<UECFWhileTrueExecute>(bComplete, InOwner);
 }
 
+/*^^^ For Each Time Sliced ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^*/
+
+FECFHandle FFlow::ForEachTimeSliced(const UObject* InOwner, int32 InNum, float InBudgetMs, TUniqueFunction<void(int32/* Index*/)>&& InItemFunc, TUniqueFunction<void(bool/* bStopped*/)>&& InDoneFunc, const FECFActionSettings& Settings/* = {}*/)
+{
+	if (UECFSubsystem* ECF = UECFSubsystem::Get(InOwner))
+		return ECF->AddAction<UECFForEachTimeSliced>(InOwner, Settings, FECFInstanceId(), InNum, InBudgetMs, MoveTemp(InItemFunc), MoveTemp(InDoneFunc));
+	else
+		return FECFHandle();
+}
+
+FECFHandle FFlow::ForEachTimeSliced(const UObject* InOwner, int32 InNum, float InBudgetMs, TUniqueFunction<void(int32/* Index*/)>&& InItemFunc, TUniqueFunction<void()>&& InDoneFunc, const FECFActionSettings& Settings/* = {}*/)
+{
+	if (UECFSubsystem* ECF = UECFSubsystem::Get(InOwner))
+		return ECF->AddAction<UECFForEachTimeSliced>(InOwner, Settings, FECFInstanceId(), InNum, InBudgetMs, MoveTemp(InItemFunc), MoveTemp(InDoneFunc));
+	else
+		return FECFHandle();
+}
+
 /*^^^ Timeline ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^*/
 
 FECFHandle FFlow::AddTimeline(const UObject* InOwner, float InStartValue, float InStopValue, float InTime, TUniqueFunction<void(float/* Value*/, float/* Time*/)>&& InTickFunc, TUniqueFunction<void(float/* Value*/, float/* Time*/, bool/* bStopped*/)>&& InCallbackFunc/* = nullptr*/, EECFBlendFunc InBlendFunc/* = EECFBlendFunc::ECFBlend_Linear*/, float InBlendExp/* = 1.f*/, const FECFActionSettings& Settings/* = {}*/)
@@ -568,6 +685,14 @@ void FEnhancedCodeFlow::RemoveAllDoNoMoreThanXTimes(const UObject* WorldContextO
 /*^^^ Run Async Then ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^*/
 
 FECFHandle FEnhancedCodeFlow::RunAsyncThen(const UObject* InOwner, TUniqueFunction<void()>&& InAsyncTaskFunc, TUniqueFunction<void(bool/* bTimedOut*/, bool/* bStopped*/)>&& InCallbackFunc, float InTimeOut, EECFAsyncPrio InThreadPriority, const FECFActionSettings& Settings)
+{
+	return RunAsyncThen(InOwner, [AsyncTaskFunc = MoveTemp(InAsyncTaskFunc)](const FECFCancellationToken& CancellationToken)
+	{
+		AsyncTaskFunc();
+	}, MoveTemp(InCallbackFunc), InTimeOut, InThreadPriority, Settings);
+}
+
+FECFHandle FEnhancedCodeFlow::RunAsyncThen(const UObject* InOwner, TUniqueFunction<void(const FECFCancellationToken&/* CancellationToken*/)>&& InAsyncTaskFunc, TUniqueFunction<void(bool/* bTimedOut*/, bool/* bStopped*/)>&& InCallbackFunc, float InTimeOut, EECFAsyncPrio InThreadPriority, const FECFActionSettings& Settings)
 {
 	if (UECFSubsystem* ECF = UECFSubsystem::Get(InOwner))
 		return ECF->AddAction<UECFRunAsyncThen>(InOwner, Settings, FECFInstanceId(), MoveTemp(InAsyncTaskFunc), MoveTemp(InCallbackFunc), InTimeOut, InThreadPriority);
@@ -576,6 +701,14 @@ FECFHandle FEnhancedCodeFlow::RunAsyncThen(const UObject* InOwner, TUniqueFuncti
 }
 
 FECFHandle FEnhancedCodeFlow::RunAsyncThen(const UObject* InOwner, TUniqueFunction<void()>&& InAsyncTaskFunc, TUniqueFunction<void(bool/* bTimedOut*/)>&& InCallbackFunc, float InTimeOut, EECFAsyncPrio InThreadPriority, const FECFActionSettings& Settings)
+{
+	return RunAsyncThen(InOwner, [AsyncTaskFunc = MoveTemp(InAsyncTaskFunc)](const FECFCancellationToken& CancellationToken)
+	{
+		AsyncTaskFunc();
+	}, MoveTemp(InCallbackFunc), InTimeOut, InThreadPriority, Settings);
+}
+
+FECFHandle FEnhancedCodeFlow::RunAsyncThen(const UObject* InOwner, TUniqueFunction<void(const FECFCancellationToken&/* CancellationToken*/)>&& InAsyncTaskFunc, TUniqueFunction<void(bool/* bTimedOut*/)>&& InCallbackFunc, float InTimeOut, EECFAsyncPrio InThreadPriority, const FECFActionSettings& Settings)
 {
 	if (UECFSubsystem* ECF = UECFSubsystem::Get(InOwner))
 		return ECF->AddAction<UECFRunAsyncThen>(InOwner, Settings, FECFInstanceId(), MoveTemp(InAsyncTaskFunc), MoveTemp(InCallbackFunc), InTimeOut, InThreadPriority);
@@ -584,6 +717,14 @@ FECFHandle FEnhancedCodeFlow::RunAsyncThen(const UObject* InOwner, TUniqueFuncti
 }
 
 FECFHandle FEnhancedCodeFlow::RunAsyncThen(const UObject* InOwner, TUniqueFunction<void()>&& InAsyncTaskFunc, TUniqueFunction<void()>&& InCallbackFunc, float InTimeOut, EECFAsyncPrio InThreadPriority, const FECFActionSettings& Settings)
+{
+	return RunAsyncThen(InOwner, [AsyncTaskFunc = MoveTemp(InAsyncTaskFunc)](const FECFCancellationToken& CancellationToken)
+	{
+		AsyncTaskFunc();
+	}, MoveTemp(InCallbackFunc), InTimeOut, InThreadPriority, Settings);
+}
+
+FECFHandle FEnhancedCodeFlow::RunAsyncThen(const UObject* InOwner, TUniqueFunction<void(const FECFCancellationToken&/* CancellationToken*/)>&& InAsyncTaskFunc, TUniqueFunction<void()>&& InCallbackFunc, float InTimeOut, EECFAsyncPrio InThreadPriority, const FECFActionSettings& Settings)
 {
 	if (UECFSubsystem* ECF = UECFSubsystem::Get(InOwner))
 		return ECF->AddAction<UECFRunAsyncThen>(InOwner, Settings, FECFInstanceId(), MoveTemp(InAsyncTaskFunc), MoveTemp(InCallbackFunc), InTimeOut, InThreadPriority);
@@ -591,12 +732,56 @@ FECFHandle FEnhancedCodeFlow::RunAsyncThen(const UObject* InOwner, TUniqueFuncti
 		return FECFHandle();
 }
 
+FECFHandle FEnhancedCodeFlow::RunAsyncJobThen(const UObject* InOwner, FECFAsyncJobPtr&& InAsyncJob, float InTimeOut, EECFAsyncPrio InThreadPriority, const FECFActionSettings& Settings)
+{
+	if (UECFSubsystem* ECF = UECFSubsystem::Get(InOwner))
+		return ECF->AddAction<UECFRunAsyncThen>(InOwner, Settings, FECFInstanceId(), MoveTemp(InAsyncJob), InTimeOut, InThreadPriority);
+	else
+		return FECFHandle();
+}
+
 void FEnhancedCodeFlow::RemoveAllRunAsyncThen(const UObject* WorldContextObject, UObject* InOwner)
 {
 	if (UECFSubsystem* ECF = UECFSubsystem::Get(WorldContextObject))
 		ECF->RemoveActionsOfClass<UECFRunAsyncThen>(false, InOwner);
 }
 
+/*^^^ Parallel For Then ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^*/
+
+FECFHandle FEnhancedCodeFlow::ParallelForThen(const UObject* InOwner, int32 InNum, TUniqueFunction<void(int32/* Index*/)>&& InBodyFunc, TUniqueFunction<void(bool/* bTimedOut*/, bool/* bStopped*/)>&& InCallbackFunc, int32 InBatchSize, float InTimeOut, EECFAsyncPrio InThreadPriority, const FECFActionSettings& Settings)
+{
+	if (UECFSubsystem* ECF = UECFSubsystem::Get(InOwner))
+		return ECF->AddAction<UECFParallelForThen>(InOwner, Settings, FECFInstanceId(), InNum, MoveTemp(InBodyFunc), MoveTemp(InCallbackFunc), InBatchSize, InTimeOut, InThreadPriority);
+	else
+		return FECFHandle();
+}
+
+FECFHandle FEnhancedCodeFlow::ParallelForThen(const UObject* InOwner, int32 InNum, TUniqueFunction<void(int32/* Index*/)>&& InBodyFunc, TUniqueFunction<void(bool/* bTimedOut*/)>&& InCallbackFunc, int32 InBatchSize, float InTimeOut, EECFAsyncPrio InThreadPriority, const FECFActionSettings& Settings)
+{
+	if (UECFSubsystem* ECF = UECFSubsystem::Get(InOwner))
+		return ECF->AddAction<UECFParallelForThen>(InOwner, Settings, FECFInstanceId(), InNum, MoveTemp(InBodyFunc), MoveTemp(InCallbackFunc), InBatchSize, InTimeOut, InThreadPriority);
+	else
+		return FECFHandle();
+}
+
+FECFHandle FEnhancedCodeFlow::ParallelForThen(const UObject* InOwner, int32 InNum, TUniqueFunction<void(int32/* Index*/)>&& InBodyFunc, TUniqueFunction<void()>&& InCallbackFunc, int32 InBatchSize, float InTimeOut, EECFAsyncPrio InThreadPriority, const FECFActionSettings& Settings)
+{
+	if (UECFSubsystem* ECF = UECFSubsystem::Get(InOwner))
+		return ECF->AddAction<UECFParallelForThen>(InOwner, Settings, FECFInstanceId(), InNum, MoveTemp(InBodyFunc), MoveTemp(InCallbackFunc), InBatchSize, InTimeOut, InThreadPriority);
+	else
+		return FECFHandle();
+}
+
+/*^^^ Run Pipeline ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^*/
+
+FECFHandle FEnhancedCodeFlow::RunPipelineDesc(const UObject* InOwner, FECFPipeline&& InPipeline, EECFAsyncPrio InThreadPriority, const FECFActionSettings& Settings)
+{
+	if (UECFSubsystem* ECF = UECFSubsystem::Get(InOwner))
+		return ECF->AddAction<UECFRunPipeline>(InOwner, Settings, FECFInstanceId(), MoveTemp(InPipeline), InThreadPriority);
+	else
+		return FECFHandle();
+}
+
 /*^^^ Load Objects Async ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^*/
 
 FECFHandle FEnhancedCodeFlow::LoadObjectsAsync(const UObject* InOwner, const TArray<FSoftObjectPath>& InObjectsToLoad, TUniqueFunction<void(bool/* bStopped*/)>&& InCallbackFunc, const FECFActionSettings& Settings)
@@ -666,9 +851,24 @@ FECFCoroutineAwaiter_WaitForFlag FEnhancedCodeFlow::WaitForFlag(const UObject* I
 	return FECFCoroutineAwaiter_WaitForFlag(InOwner, Settings, bInFlag, InTimeOut);
 }
 
+/*^^^ Wait For Signal (Coroutine) ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^*/
+
+FECFCoroutineAwaiter_WaitForSignal FEnhancedCodeFlow::WaitForSignal(const UObject* InOwner, const FECFSignal& InSignal, float InTimeOut /*= 0.f*/, const FECFActionSettings& Settings /*= {}*/)
+{
+	return FECFCoroutineAwaiter_WaitForSignal(InOwner, Settings, InSignal, InTimeOut);
+}
+
 /*^^^ Run Async And Wait (Coroutine) ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^*/
 
 FECFCoroutineAwaiter_RunAsyncAndWait FEnhancedCodeFlow::RunAsyncAndWait(const UObject* InOwner, TUniqueFunction<void()>&& InAsyncTaskFunc, float InTimeOut, EECFAsyncPrio InThreadPriority, const FECFActionSettings& Settings)
+{
+	return FECFCoroutineAwaiter_RunAsyncAndWait(InOwner, Settings, [AsyncTaskFunc = MoveTemp(InAsyncTaskFunc)](const FECFCancellationToken& CancellationToken)
+	{
+		AsyncTaskFunc();
+	}, InTimeOut, InThreadPriority);
+}
+
+FECFCoroutineAwaiter_RunAsyncAndWait FEnhancedCodeFlow::RunAsyncAndWait(const UObject* InOwner, TUniqueFunction<void(const FECFCancellationToken&/* CancellationToken*/)>&& InAsyncTaskFunc, float InTimeOut, EECFAsyncPrio InThreadPriority, const FECFActionSettings& Settings)
 {
 	return FECFCoroutineAwaiter_RunAsyncAndWait(InOwner, Settings, MoveTemp(InAsyncTaskFunc), InTimeOut, InThreadPriority);
 }
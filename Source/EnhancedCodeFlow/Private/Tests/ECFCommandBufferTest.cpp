@@ -0,0 +1,92 @@
+// Copyright (c) 2026 Damian Nowakowski. All rights reserved.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "ECFTestWorld.h"
+#include "EnhancedCodeFlow.h"
+#include "Async/Async.h"
+
+ECF_PRAGMA_DISABLE_OPTIMIZATION
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FECFCommandBufferMultiProducerTest, "EnhancedCodeFlow.CommandBuffer.MultiProducer", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FECFCommandBufferMultiProducerTest::RunTest(const FString& Parameters)
+{
+	FECFTestWorld TestWorld;
+	if (TestTrue(TEXT("Test world created"), TestWorld.IsValid()) == false)
+	{
+		return false;
+	}
+	UWorld* World = TestWorld.GetWorld();
+
+	constexpr int32 ProducersNum = 8;
+	constexpr int32 BuffersPerProducer = 500;
+	constexpr int32 SharedHandlesNum = 16;
+
+	// Handles controlled by all producers at once.
+	TArray<FECFHandle> SharedHandles;
+	for (int32 HandleIndex = 0; HandleIndex < SharedHandlesNum; HandleIndex++)
+	{
+		SharedHandles.Add(FFlow::AddTicker(World, [](float DeltaTime) {}, [](bool bStopped) {}));
+	}
+
+	// Every producer stops its own action with the last buffer, so it can be checked that every producer has been applied.
+	int32 CompletedProducers = 0;
+	TArray<FECFHandle> ProducerHandles;
+	for (int32 ProducerIndex = 0; ProducerIndex < ProducersNum; ProducerIndex++)
+	{
+		ProducerHandles.Add(FFlow::AddTicker(World, [](float DeltaTime) {}, [&CompletedProducers](bool bStopped)
+		{
+			CompletedProducers++;
+		}));
+	}
+
+	TArray<TFuture<void>> Producers;
+	for (int32 ProducerIndex = 0; ProducerIndex < ProducersNum; ProducerIndex++)
+	{
+		Producers.Add(Async(EAsyncExecution::Thread, [World, &SharedHandles, ProducerHandle = ProducerHandles[ProducerIndex]]()
+		{
+			for (int32 BufferIndex = 0; BufferIndex < BuffersPerProducer; BufferIndex++)
+			{
+				// Every buffer leaves the shared actions running, whatever the order of buffers from different producers is.
+				FECFCommandBuffer Commands;
+				for (const FECFHandle& Handle : SharedHandles)
+				{
+					Commands.PauseAction(Handle).ResumeAction(Handle);
+				}
+				FFlow::QueueCommands(World, MoveTemp(Commands));
+			}
+			FFlow::QueueCommands(World, FECFCommandBuffer().StopAction(ProducerHandle, true));
+		}));
+	}
+	for (TFuture<void>& Producer : Producers)
+	{
+		Producer.Wait();
+	}
+
+	TestWorld.TickFrame();
+
+	TestEqual(TEXT("Every producer's last buffer has been applied"), CompletedProducers, ProducersNum);
+	for (const FECFHandle& Handle : SharedHandles)
+	{
+		bool bIsPaused = true;
+		TestTrue(TEXT("Shared action is running"), FFlow::IsActionPaused(World, Handle, bIsPaused));
+		TestFalse(TEXT("Shared action is not paused"), bIsPaused);
+	}
+#if ECF_LOGS
+	// Looking up a stopped action reports that it couldn't be found.
+	AddExpectedError(TEXT("Couldn't find action of handle"), EAutomationExpectedErrorFlags::Contains, ProducersNum);
+#endif
+	for (const FECFHandle& Handle : ProducerHandles)
+	{
+		TestFalse(TEXT("Producer action is stopped"), FFlow::IsActionRunning(World, Handle));
+	}
+
+	return true;
+}
+
+ECF_PRAGMA_ENABLE_OPTIMIZATION
+
+#endif
\ No newline at end of file
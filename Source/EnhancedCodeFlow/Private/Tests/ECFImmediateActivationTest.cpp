@@ -0,0 +1,70 @@
+// Copyright (c) 2026 Damian Nowakowski. All rights reserved.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "ECFTestWorld.h"
+#include "EnhancedCodeFlow.h"
+
+ECF_PRAGMA_DISABLE_OPTIMIZATION
+
+namespace ECFImmediateActivationTest
+{
+	// Starts the chain of actions, each starting the next one from its callback, until the given number of hops is done.
+	void StartChain(UWorld* World, int32* HopsDone, int32 HopsNum)
+	{
+		FFlow::DelayTicks(World, 0, [World, HopsDone, HopsNum]()
+		{
+			(*HopsDone)++;
+			if (*HopsDone < HopsNum)
+			{
+				StartChain(World, HopsDone, HopsNum);
+			}
+		}, FECFActionSettings().WithImmediateActivation());
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FECFImmediateActivationTest, "EnhancedCodeFlow.Tick.ImmediateActivation", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FECFImmediateActivationTest::RunTest(const FString& Parameters)
+{
+	FECFTestWorld TestWorld;
+	if (TestTrue(TEXT("Test world created"), TestWorld.IsValid()) == false)
+	{
+		return false;
+	}
+	UWorld* World = TestWorld.GetWorld();
+
+	// The first action of the chain is started outside of the sweep, so it doesn't count as an immediate activation.
+	constexpr int32 MaxHopsPerFrame = UECFSubsystem::MaxImmediateActivationsPerSweep + 1;
+
+	// Chain shorter than the limit finishes in a single frame.
+	{
+		constexpr int32 HopsNum = 64;
+		int32 HopsDone = 0;
+		ECFImmediateActivationTest::StartChain(World, &HopsDone, HopsNum);
+		TestWorld.TickFrame();
+		TestEqual(TEXT("Short chain finished in one frame"), HopsDone, HopsNum);
+	}
+
+	// Chain longer than the limit spills over to the next frame.
+	{
+		constexpr int32 HopsNum = MaxHopsPerFrame + 44;
+		int32 HopsDone = 0;
+#if ECF_LOGS
+		AddExpectedError(TEXT("Too many actions activated immediately in one tick"), EAutomationExpectedErrorFlags::Contains, 1);
+#endif
+		ECFImmediateActivationTest::StartChain(World, &HopsDone, HopsNum);
+		TestWorld.TickFrame();
+		TestEqual(TEXT("Long chain stopped at the limit in the first frame"), HopsDone, MaxHopsPerFrame);
+		TestWorld.TickFrame();
+		TestEqual(TEXT("Long chain finished in the next frame"), HopsDone, HopsNum);
+	}
+
+	return true;
+}
+
+ECF_PRAGMA_ENABLE_OPTIMIZATION
+
+#endif
\ No newline at end of file
@@ -0,0 +1,86 @@
+// Copyright (c) 2026 Damian Nowakowski. All rights reserved.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "ECFTestWorld.h"
+#include "EnhancedCodeFlow.h"
+#include "GameFramework/Actor.h"
+#include "HAL/PlatformTime.h"
+#include "Async/TaskGraphInterfaces.h"
+
+ECF_PRAGMA_DISABLE_OPTIMIZATION
+
+namespace ECFParallelTickBenchmark
+{
+	constexpr int32 TickersNum = 50000;
+	constexpr int32 OwnersNum = 256;
+	constexpr int32 FramesNum = 60;
+
+	// Ticks the tickers with or without the thread safe tick and returns the average time of a frame in seconds.
+	double Run(FAutomationTestBase& Test, bool bThreadSafeTick)
+	{
+		FECFTestWorld TestWorld;
+		if (Test.TestTrue(TEXT("Test world created"), TestWorld.IsValid()) == false)
+		{
+			return 0.0;
+		}
+		UWorld* World = TestWorld.GetWorld();
+
+		// Actions are partitioned by owner, so the tickers are spread across many owners.
+		TArray<AActor*> Owners;
+		for (int32 OwnerIndex = 0; OwnerIndex < OwnersNum; OwnerIndex++)
+		{
+			Owners.Add(World->SpawnActor<AActor>());
+		}
+
+		// Every ticker only touches its own value, like a ticker writing to the data of its owner.
+		TArray<double> Values;
+		Values.SetNumZeroed(TickersNum);
+		const FECFActionSettings Settings = bThreadSafeTick ? FECFActionSettings().WithThreadSafeTick() : FECFActionSettings();
+		for (int32 TickerIndex = 0; TickerIndex < TickersNum; TickerIndex++)
+		{
+			double* Value = &Values[TickerIndex];
+			FFlow::AddTicker(Owners[TickerIndex % OwnersNum], [Value](float DeltaTime)
+			{
+				for (int32 Step = 0; Step < 32; Step++)
+				{
+					*Value = FMath::Sin(*Value + DeltaTime) * 0.5 + Step;
+				}
+			}, [](bool bStopped) {}, Settings);
+		}
+
+		// The first frame merges all new actions, so it is not measured.
+		TestWorld.TickFrame();
+
+		const uint64 StartCycles = FPlatformTime::Cycles64();
+		for (int32 Frame = 0; Frame < FramesNum; Frame++)
+		{
+			TestWorld.TickFrame();
+		}
+		return FPlatformTime::ToSeconds64(FPlatformTime::Cycles64() - StartCycles) / FramesNum;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FECFParallelTickBenchmark, "EnhancedCodeFlow.Benchmark.ParallelTick", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FECFParallelTickBenchmark::RunTest(const FString& Parameters)
+{
+	const double SerialSeconds = ECFParallelTickBenchmark::Run(*this, false);
+	const double ParallelSeconds = ECFParallelTickBenchmark::Run(*this, true);
+	if (SerialSeconds <= 0.0 || ParallelSeconds <= 0.0)
+	{
+		return false;
+	}
+
+	AddInfo(FString::Printf(TEXT("%d tickers of %d owners, %d worker threads: serial %.3f ms, parallel %.3f ms per frame, speedup %.2fx."),
+		ECFParallelTickBenchmark::TickersNum, ECFParallelTickBenchmark::OwnersNum, FTaskGraphInterface::Get().GetNumWorkerThreads(),
+		SerialSeconds * 1000.0, ParallelSeconds * 1000.0, SerialSeconds / ParallelSeconds));
+
+	return true;
+}
+
+ECF_PRAGMA_ENABLE_OPTIMIZATION
+
+#endif
\ No newline at end of file
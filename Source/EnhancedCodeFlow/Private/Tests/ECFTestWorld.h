@@ -0,0 +1,76 @@
+// Copyright (c) 2026 Damian Nowakowski. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "ECFSubsystem.h"
+#include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "Misc/App.h"
+#include "Tickable.h"
+
+ECF_PRAGMA_DISABLE_OPTIMIZATION
+
+/**
+ * Standalone game world with its own ECF subsystem, ticked manually by the automation tests.
+ * The world and the game instance are destroyed when this object goes out of scope.
+ */
+class FECFTestWorld
+{
+
+public:
+
+	FECFTestWorld()
+	{
+		GameInstance = NewObject<UGameInstance>(GEngine);
+		GameInstance->AddToRoot();
+		GameInstance->InitializeStandalone();
+		World = GameInstance->GetWorld();
+		Subsystem = GameInstance->GetSubsystem<UECFSubsystem>();
+	}
+
+	~FECFTestWorld()
+	{
+		GameInstance->Shutdown();
+		if (World)
+		{
+			GEngine->DestroyWorldContext(World);
+			World->DestroyWorld(false);
+		}
+		GameInstance->RemoveFromRoot();
+	}
+
+	// Checks if the world and its subsystem have been created.
+	bool IsValid() const
+	{
+		return World && Subsystem;
+	}
+
+	// Ticks the subsystem as in a new frame with the given delta time.
+	void TickFrame(float DeltaTime = 1.f / 60.f)
+	{
+		// Clocks advance once per frame, so every manual tick must be a new frame.
+		GFrameCounter++;
+		FApp::SetDeltaTime(DeltaTime);
+		static_cast<FTickableGameObject*>(Subsystem)->Tick(DeltaTime);
+	}
+
+	UWorld* GetWorld() const
+	{
+		return World;
+	}
+
+private:
+
+	UGameInstance* GameInstance = nullptr;
+	UWorld* World = nullptr;
+	UECFSubsystem* Subsystem = nullptr;
+};
+
+ECF_PRAGMA_ENABLE_OPTIMIZATION
+
+#endif
\ No newline at end of file
@@ -0,0 +1,74 @@
+// Copyright (c) 2026 Damian Nowakowski. All rights reserved.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "ECFTestWorld.h"
+#include "EnhancedCodeFlow.h"
+#include "HAL/PlatformTime.h"
+
+ECF_PRAGMA_DISABLE_OPTIMIZATION
+
+namespace ECFTickSweepBenchmark
+{
+	// Delay restarting itself when it's done, so the sweep removes and adds actions every frame.
+	void StartChurningDelay(UWorld* World, int32 DelayTicks)
+	{
+		FFlow::DelayTicks(World, DelayTicks, [World, DelayTicks]()
+		{
+			StartChurningDelay(World, DelayTicks);
+		});
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FECFTickSweepBenchmark, "EnhancedCodeFlow.Benchmark.TickSweep", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FECFTickSweepBenchmark::RunTest(const FString& Parameters)
+{
+	constexpr int32 FramesNum = 100;
+	const int32 ActionsNums[] = { 1000, 10000, 100000 };
+
+	for (const int32 ActionsNum : ActionsNums)
+	{
+		FECFTestWorld TestWorld;
+		if (TestTrue(TEXT("Test world created"), TestWorld.IsValid()) == false)
+		{
+			return false;
+		}
+		UWorld* World = TestWorld.GetWorld();
+
+		// Half of the actions tick every frame, the other half finish every few frames and are replaced by new ones.
+		int64 TicksNum = 0;
+		for (int32 ActionIndex = 0; ActionIndex < ActionsNum / 2; ActionIndex++)
+		{
+			FFlow::AddTicker(World, [&TicksNum](float DeltaTime)
+			{
+				TicksNum++;
+			}, [](bool bStopped) {});
+			ECFTickSweepBenchmark::StartChurningDelay(World, ActionIndex % 8);
+		}
+
+		// The first frame merges all new actions, so it is not measured.
+		TestWorld.TickFrame();
+		TicksNum = 0;
+
+		const uint64 StartCycles = FPlatformTime::Cycles64();
+		for (int32 Frame = 0; Frame < FramesNum; Frame++)
+		{
+			TestWorld.TickFrame();
+		}
+		const double Seconds = FPlatformTime::ToSeconds64(FPlatformTime::Cycles64() - StartCycles);
+
+		TestEqual(TEXT("Every ticker ticked every frame"), TicksNum, static_cast<int64>(ActionsNum / 2) * FramesNum);
+		AddInfo(FString::Printf(TEXT("Tick sweep of %d actions: %.3f ms per frame, %.1f ns per action."),
+			ActionsNum, Seconds * 1000.0 / FramesNum, Seconds * 1.0e9 / (static_cast<double>(ActionsNum) * FramesNum)));
+	}
+
+	// Cache misses are not available to automation tests. Profile this test with Unreal Insights or a hardware profiler to see them.
+	return true;
+}
+
+ECF_PRAGMA_ENABLE_OPTIMIZATION
+
+#endif
\ No newline at end of file
@@ -54,7 +54,7 @@ protected:
 		else
 		{
 #if ECF_LOGS
-			UE_LOG(LogECF, Error, TEXT("ECF Coroutine [%s] - Loop and Wait failed to start. Are you sure the Predicate and TickFunction are set properly?"), *Settings.Label);
+			UE_LOG(LogECF, Error, TEXT("ECF Coroutine [%s] - Loop and Wait failed to start. Are you sure the Predicate and TickFunction are set properly?"), *Settings->Label);
 #endif
 			return false;
 		}
@@ -3,9 +3,10 @@
 #pragma once
 
 #include "Coroutines/ECFCoroutineActionBase.h"
-#include "Templates/Atomic.h"
 #include "Async/Async.h"
 #include "ECFTypes.h"
+#include "ECFCancellationToken.h"
+#include "ECFAsyncJob.h"
 #include "Async/TaskGraphInterfaces.h"
 #include "ECFRunAsyncAndWait.generated.h"
 
@@ -20,18 +21,21 @@ class ENHANCEDCODEFLOW_API UECFRunAsyncAndWait: public UECFCoroutineActionBase
 
 protected:
 
-	TUniqueFunction<void()> AsyncTaskFunc;
+	// Task and its result. The job's callback passes the result to the awaiter.
+	FECFAsyncJobPtr AsyncJob;
 	float TimeOut = 0.f;
 	float OriginTimeOut = 0.f;
 	bool bWithTimeOut = false;
 	bool bTimedOut = false;
 
 	ENamedThreads::Type ThreadType = ENamedThreads::AnyBackgroundThreadNormalTask;
-	TAtomic<bool> bIsAsyncTaskDone = false;
 
-	bool Setup(TUniqueFunction<void()>&& InAsyncTaskFunc, float InTimeOut, EECFAsyncPrio InThreadPriority)
+	// Cancelled when this action is stopped, timed out or removed, so the async task can bail out early.
+	FECFCancellationToken CancellationToken;
+
+	bool Setup(FECFAsyncJobPtr&& InAsyncJob, float InTimeOut, EECFAsyncPrio InThreadPriority)
 	{
-		AsyncTaskFunc = MoveTemp(InAsyncTaskFunc);
+		AsyncJob = MoveTemp(InAsyncJob);
 
 		switch (InThreadPriority)
 		{
@@ -43,30 +47,30 @@ protected:
 				break;
 		}
 
-		if (AsyncTaskFunc)
+		if (AsyncJob.IsValid())
 		{
 			if (InTimeOut > 0.f)
 			{
 				bWithTimeOut = true;
 				TimeOut = InTimeOut;
 				OriginTimeOut = InTimeOut;
-				SetMaxActionTime(TimeOut);
 			}
 			else
 			{
 				bWithTimeOut = false;
 			}
 
-			bIsAsyncTaskDone = false;
-
-			TWeakObjectPtr<ThisClass> WeakThis(this);
-			AsyncTask(ThreadType, [WeakThis]()
+			// The action is parked while waiting for the async task, so it must be woken up when the task is done.
+			// The worker keeps the job alive by itself and never touches the action.
+			LaunchAsyncTask(ThreadType, [Job = AsyncJob, AsyncCompletion = GetAsyncCompletion(), Token = CancellationToken]()
 			{
-				if (ThisClass* StrongThis = WeakThis.Get())
+				if (Token.IsCancelled())
 				{
-					StrongThis->AsyncTaskFunc();
-					StrongThis->bIsAsyncTaskDone = true;
+					return;
 				}
+
+				Job->Execute(Token);
+				AsyncCompletion.Signal();
 			});
 
 			return true;
@@ -74,7 +78,7 @@ protected:
 		else
 		{
 #if ECF_LOGS
-			UE_LOG(LogECF, Error, TEXT("ECF Coroutine [%s] - Run Async Task and Wait failed to start. Are you sure the AsyncTask function is set properly?"), *Settings.Label);
+			UE_LOG(LogECF, Error, TEXT("ECF Coroutine [%s] - Run Async Task and Wait failed to start. Are you sure the AsyncTask function is set properly?"), *Settings->Label);
 #endif
 			return false;
 		}
@@ -85,6 +89,12 @@ protected:
 		if (bWithTimeOut)
 		{
 			TimeOut = OriginTimeOut;
+
+			// Restart the deadline of the waiting action.
+			if (IsParked())
+			{
+				Park(TimeOut);
+			}
 		}
 		return true;
 	}
@@ -99,27 +109,39 @@ protected:
 		TRACE_CPUPROFILER_EVENT_SCOPE("ECF - RunAsyncAndWait Tick");
 #endif
 
-		if (bWithTimeOut)
-		{
-			TimeOut -= DeltaTime;
-			if (TimeOut <= 0.f)
-			{
-				bTimedOut = true;
-				MarkAsFinished();
-				Complete(false);
-				return;
-			}
-		}
-
-		if (bIsAsyncTaskDone)
+		if (AsyncJob->IsDone())
 		{
 			MarkAsFinished();
 			Complete(false);
+			return;
 		}
+
+		// Don't poll the async task every tick. Wait for it without ticking until it is done or until the time out passes.
+		Park(bWithTimeOut ? TimeOut : 0.f);
+	}
+
+	void DeadlineReached() override
+	{
+		CancellationToken.Cancel();
+		bTimedOut = true;
+		MarkAsFinished();
+		Complete(false);
+	}
+
+	void Removed() override
+	{
+		CancellationToken.Cancel();
 	}
 
 	void Complete(bool bStopped) override
 	{
+		if (bStopped)
+		{
+			CancellationToken.Cancel();
+		}
+
+		AsyncJob->Finish(AsyncJob->IsDone(), bTimedOut, bStopped);
+
 		CoroutineHandle.promise().bTimedOut = bTimedOut;
 		CoroutineHandle.promise().bStopped = bStopped;
 		CoroutineHandle.resume();
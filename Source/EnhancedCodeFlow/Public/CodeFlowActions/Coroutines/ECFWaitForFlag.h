@@ -49,7 +49,7 @@ protected:
 		else
 		{
 #if ECF_LOGS
-			UE_LOG(LogECF, Error, TEXT("ECF Coroutine [%s] - Wait For Flag failed to start. Are you sure the Flag is set properly?"), *Settings.Label);
+			UE_LOG(LogECF, Error, TEXT("ECF Coroutine [%s] - Wait For Flag failed to start. Are you sure the Flag is set properly?"), *Settings->Label);
 #endif
 			return false;
 		}
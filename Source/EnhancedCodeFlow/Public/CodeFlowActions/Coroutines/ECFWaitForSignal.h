@@ -0,0 +1,90 @@
+// Copyright (c) 2026 Damian Nowakowski. All rights reserved.
+
+#pragma once
+
+#include "Coroutines/ECFCoroutineActionBase.h"
+#include "ECFSignal.h"
+#include "ECFWaitForSignal.generated.h"
+
+ECF_PRAGMA_DISABLE_OPTIMIZATION
+
+UCLASS()
+class ENHANCEDCODEFLOW_API UECFWaitForSignal : public UECFCoroutineActionBase
+{
+	GENERATED_BODY()
+
+	friend class UECFSubsystem;
+
+protected:
+
+	FECFSignal Signal;
+	float TimeOut = 0.f;
+	bool bTimedOut = false;
+
+	bool Setup(const FECFSignal& InSignal, float InTimeOut)
+	{
+		// The signal set in the meantime is handled in Init, so the coroutine is resumed with a valid result.
+		Signal = InSignal;
+		TimeOut = FMath::Max(InTimeOut, 0.f);
+		bTimedOut = false;
+		return true;
+	}
+
+	// Waiting doesn't tick. The action waits parked until the signal is set or until the time out passes.
+	void Init() override
+	{
+		Park(TimeOut);
+
+		// The signal could have been set from another thread in the meantime.
+		if (Signal.AddWaiter(this, GetAsyncCompletion()) == false)
+		{
+			GetAsyncCompletion().Signal();
+		}
+	}
+
+	bool Reset(bool bCallUpdate) override
+	{
+		// Restart the deadline of the waiting action.
+		if (TimeOut > 0.f && IsParked())
+		{
+			Park(TimeOut);
+		}
+		return true;
+	}
+
+	void DeadlineReached() override
+	{
+		bTimedOut = true;
+		MarkAsFinished();
+		Complete(false);
+	}
+
+	// Ticked only when the signal has been set.
+	void Tick(float DeltaTime) override
+	{
+#if STATS
+		DECLARE_SCOPE_CYCLE_COUNTER(TEXT("WaitForSignal - Tick"), STAT_ECFDETAILS_WAITFORSIGNAL, STATGROUP_ECFDETAILS);
+#endif
+
+#if ECF_INSIGHT_PROFILING
+		TRACE_CPUPROFILER_EVENT_SCOPE("ECF - WaitForSignal Tick");
+#endif
+
+		MarkAsFinished();
+		Complete(false);
+	}
+
+	void Removed() override
+	{
+		Signal.RemoveWaiter(this);
+	}
+
+	void Complete(bool bStopped) override
+	{
+		CoroutineHandle.promise().bTimedOut = bTimedOut;
+		CoroutineHandle.promise().bStopped = bStopped;
+		CoroutineHandle.resume();
+	}
+};
+
+ECF_PRAGMA_ENABLE_OPTIMIZATION
\ No newline at end of file
@@ -26,7 +26,7 @@ protected:
 		if (InObjectsToLoad.Num() == 0)
 		{
 #if ECF_LOGS
-			UE_LOG(LogECF, Error, TEXT("ECF Coroutine [%s] - wait load objects failed to start. Objects array is empty."), *Settings.Label);
+			UE_LOG(LogECF, Error, TEXT("ECF Coroutine [%s] - wait load objects failed to start. Objects array is empty."), *Settings->Label);
 #endif
 			return false;
 		}
@@ -34,7 +34,7 @@ protected:
 		ObjectsToLoad = InObjectsToLoad;
 
 #if ECF_LOGS
-		UE_LOG(LogECF, Log, TEXT("ECF Coroutine [%s] - Loading %d objects asynchronously."), *Settings.Label, ObjectsToLoad.Num());
+		UE_LOG(LogECF, Log, TEXT("ECF Coroutine [%s] - Loading %d objects asynchronously."), *Settings->Label, ObjectsToLoad.Num());
 #endif
 
 		return true;
@@ -45,7 +45,7 @@ protected:
 		if (InObjectsToLoad.Num() == 0)
 		{
 #if ECF_LOGS
-			UE_LOG(LogECF, Error, TEXT("ECF Coroutine [%s] - wait load objects (Primary Assets) failed to start. Objects array is empty."), *Settings.Label);
+			UE_LOG(LogECF, Error, TEXT("ECF Coroutine [%s] - wait load objects (Primary Assets) failed to start. Objects array is empty."), *Settings->Label);
 #endif
 			return false;
 		}
@@ -53,7 +53,7 @@ protected:
 		PrimaryAssetsToLoad = InObjectsToLoad;
 
 #if ECF_LOGS
-		UE_LOG(LogECF, Log, TEXT("ECF Coroutine [%s] - Loading %d objects (Primary Assets) asynchronously."), *Settings.Label, PrimaryAssetsToLoad.Num());
+		UE_LOG(LogECF, Log, TEXT("ECF Coroutine [%s] - Loading %d objects (Primary Assets) asynchronously."), *Settings->Label, PrimaryAssetsToLoad.Num());
 #endif
 
 		return true;
@@ -75,7 +75,7 @@ protected:
 						if (StrongThis->IsValid())
 						{
 #if ECF_LOGS
-							UE_LOG(LogECF, Log, TEXT("ECF Coroutine [%s] - Finished loading %d objects."), *StrongThis->Settings.Label, StrongThis->ObjectsToLoad.Num());
+							UE_LOG(LogECF, Log, TEXT("ECF Coroutine [%s] - Finished loading %d objects."), *StrongThis->Settings->Label, StrongThis->ObjectsToLoad.Num());
 #endif
 							StrongThis->MarkAsFinished();
 							StrongThis->Complete(false);
@@ -96,7 +96,7 @@ protected:
 						if (StrongThis->IsValid())
 						{
 #if ECF_LOGS
-							UE_LOG(LogECF, Log, TEXT("ECF Coroutine [%s] - Finished loading %d objects (Primary Assets)."), *StrongThis->Settings.Label, StrongThis->PrimaryAssetsToLoad.Num());
+							UE_LOG(LogECF, Log, TEXT("ECF Coroutine [%s] - Finished loading %d objects (Primary Assets)."), *StrongThis->Settings->Label, StrongThis->PrimaryAssetsToLoad.Num());
 #endif
 							StrongThis->MarkAsFinished();
 							StrongThis->Complete(false);
@@ -108,7 +108,7 @@ protected:
 		else
 		{
 #if ECF_LOGS
-			UE_LOG(LogECF, Error, TEXT("ECF Coroutine [%s] - wait load objects failed to initialize. Objects arrays are empty."), *Settings.Label);
+			UE_LOG(LogECF, Error, TEXT("ECF Coroutine [%s] - wait load objects failed to initialize. Objects arrays are empty."), *Settings->Label);
 #endif
 		}
 	}
@@ -17,7 +17,6 @@ class ENHANCEDCODEFLOW_API UECFWaitSeconds : public UECFCoroutineActionBase
 protected:
 
 	float WaitTime = 0.f;
-	float CurrentTime = 0.f;
 
 	bool Setup(float InWaitTime)
 	{
@@ -25,32 +24,36 @@ protected:
 
 		if (WaitTime >= 0)
 		{
-			if (WaitTime > 0)
-			{
-				SetMaxActionTime(WaitTime);
-			}
 			return true;
 		}
 		else
 		{
 #if ECF_LOGS
-			UE_LOG(LogECF, Error, TEXT("ECF Coroutine [%s] - wait seconds failed to start. Are you sure the WaitTime is not negative?"), *Settings.Label);
+			UE_LOG(LogECF, Error, TEXT("ECF Coroutine [%s] - wait seconds failed to start. Are you sure the WaitTime is not negative?"), *Settings->Label);
 #endif
 			return false;
 		}
 	}
 
+	// Waiting doesn't tick. The action waits parked until its deadline passes.
 	void Init() override
 	{
-		CurrentTime = 0;
+		WaitForActionTime(WaitTime);
 	}
 
 	bool Reset(bool bCallUpdate) override
 	{
-		CurrentTime = 0;
+		WaitForActionTime(WaitTime);
 		return true;
 	}
 
+	void DeadlineReached() override
+	{
+		MarkAsFinished();
+		Complete(false);
+	}
+
+	// Ticked only when there was no time to wait for.
 	void Tick(float DeltaTime) override
 	{
 #if STATS
@@ -61,12 +64,8 @@ protected:
 		TRACE_CPUPROFILER_EVENT_SCOPE("ECF - WaitSeconds Tick");
 #endif
 
-		CurrentTime += DeltaTime;
-		if (CurrentTime > WaitTime)
-		{
-			MarkAsFinished();
-			Complete(false);
-		}
+		MarkAsFinished();
+		Complete(false);
 	}
 
 	void Complete(bool bStopped) override
@@ -77,19 +76,19 @@ protected:
 
 	float GetActionTime() const override
 	{
-		return CurrentTime;
+		return GetWaitedActionTime();
 	}
 
 	bool SetActionTime(float NewTime, bool bCallUpdate) override
 	{
-		CurrentTime = NewTime;
-		if (bCallUpdate)
+		if (bCallUpdate && NewTime > WaitTime)
+		{
+			MarkAsFinished();
+			Complete(false);
+		}
+		else
 		{
-			if (CurrentTime > WaitTime)
-			{
-				MarkAsFinished();
-				Complete(false);
-			}
+			WaitForActionTime(WaitTime, NewTime);
 		}
 		return true;
 	}
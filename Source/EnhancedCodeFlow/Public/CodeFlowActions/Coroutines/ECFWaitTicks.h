@@ -30,7 +30,7 @@ protected:
 		else
 		{
 #if ECF_LOGS
-			UE_LOG(LogECF, Error, TEXT("ECF Coroutine [%s]- wait ticks failed to start. Are you sure the WaitTicks is not negative?"), *Settings.Label);
+			UE_LOG(LogECF, Error, TEXT("ECF Coroutine [%s]- wait ticks failed to start. Are you sure the WaitTicks is not negative?"), *Settings->Label);
 #endif
 			return false;
 		}
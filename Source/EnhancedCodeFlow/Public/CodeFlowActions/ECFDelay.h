@@ -19,7 +19,6 @@ protected:
 	TUniqueFunction<void(bool)> CallbackFunc;
 	TUniqueFunction<void()> CallbackFunc_NoStopped;
 	float DelayTime = 0.f;
-	float CurrentTime = 0.f;
 
 	bool Setup(float InDelayTime, TUniqueFunction<void(bool)>&& InCallbackFunc)
 	{
@@ -28,16 +27,12 @@ protected:
 
 		if (CallbackFunc && DelayTime >= 0)
 		{
-			if (DelayTime > 0)
-			{
-				SetMaxActionTime(DelayTime);
-			}
 			return true;
 		}
 		else
 		{
 #if ECF_LOGS
-			UE_LOG(LogECF, Error, TEXT("ECF - [%s] delay failed to start. Are you sure the DelayTime is not negative and Callback Function is set properly?"), *Settings.Label);
+			UE_LOG(LogECF, Error, TEXT("ECF - [%s] delay failed to start. Are you sure the DelayTime is not negative and Callback Function is set properly?"), *Settings->Label);
 #endif
 			return false;
 		}
@@ -56,23 +51,31 @@ protected:
 		else
 		{
 #if ECF_LOGS
-			UE_LOG(LogECF, Error, TEXT("ECF - [%s] delay failed to start. Are you sure the Callback Function is set properly?"), *Settings.Label);
+			UE_LOG(LogECF, Error, TEXT("ECF - [%s] delay failed to start. Are you sure the Callback Function is set properly?"), *Settings->Label);
 #endif
 			return false;
 		}
 	}
 
+	// The delay doesn't tick. It waits parked until its deadline passes.
 	void Init() override
 	{
-		CurrentTime = 0;
+		WaitForActionTime(DelayTime);
 	}
 
 	bool Reset(bool bCallUpdate) override
 	{
-		CurrentTime = 0;
+		WaitForActionTime(DelayTime);
 		return true;
 	}
 
+	void DeadlineReached() override
+	{
+		MarkAsFinished();
+		Complete(false);
+	}
+
+	// Ticked only when there was no time to wait for.
 	void Tick(float DeltaTime) override
 	{
 #if STATS
@@ -83,12 +86,8 @@ protected:
 		TRACE_CPUPROFILER_EVENT_SCOPE("ECF - Delay Tick");
 #endif
 
-		CurrentTime += DeltaTime;
-		if (CurrentTime > DelayTime)
-		{
-			MarkAsFinished();
-			Complete(false);
-		}
+		MarkAsFinished();
+		Complete(false);
 	}
 
 	void Complete(bool bStopped) override
@@ -98,19 +97,19 @@ protected:
 
 	float GetActionTime() const override
 	{
-		return CurrentTime;
+		return GetWaitedActionTime();
 	}
 
 	bool SetActionTime(float NewTime, bool bCallUpdate) override
 	{
-		CurrentTime = NewTime;
-		if (bCallUpdate)
+		if (bCallUpdate && NewTime > DelayTime)
 		{
-			if (CurrentTime > DelayTime)
-			{
-				MarkAsFinished();
-				Complete(false);
-			}
+			MarkAsFinished();
+			Complete(false);
+		}
+		else
+		{
+			WaitForActionTime(DelayTime, NewTime);
 		}
 		return true;
 	}
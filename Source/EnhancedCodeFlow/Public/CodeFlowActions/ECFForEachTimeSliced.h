@@ -0,0 +1,144 @@
+// Copyright (c) 2026 Damian Nowakowski. All rights reserved.
+
+#pragma once
+
+#include "ECFActionBase.h"
+#include "HAL/PlatformTime.h"
+#include "ECFForEachTimeSliced.generated.h"
+
+ECF_PRAGMA_DISABLE_OPTIMIZATION
+
+UCLASS()
+class ENHANCEDCODEFLOW_API UECFForEachTimeSliced : public UECFActionBase
+{
+	GENERATED_BODY()
+
+	friend class UECFSubsystem;
+
+protected:
+
+	TUniqueFunction<void(int32)> ItemFunc;
+	TUniqueFunction<void(bool)> DoneFunc;
+	TUniqueFunction<void()> DoneFunc_NoStopped;
+
+	int32 Num = 0;
+	int32 NextIndex = 0;
+
+	// Time budget of a single tick in cycles.
+	uint64 BudgetCycles = 0;
+
+	// Smoothed cost of a single item in cycles. Used to estimate how many items fit into the remaining budget.
+	double AverageItemCycles = 0.0;
+
+	bool Setup(int32 InNum, float InBudgetMs, TUniqueFunction<void(int32)>&& InItemFunc, TUniqueFunction<void(bool)>&& InDoneFunc)
+	{
+		ItemFunc = MoveTemp(InItemFunc);
+		DoneFunc = MoveTemp(InDoneFunc);
+
+		if (ItemFunc && InBudgetMs > 0.f)
+		{
+			// Empty range is valid. The action finishes on its first tick.
+			Num = FMath::Max(InNum, 0);
+			NextIndex = 0;
+			BudgetCycles = FMath::Max<uint64>(static_cast<uint64>(InBudgetMs / (1000.0 * FPlatformTime::GetSecondsPerCycle64())), 1);
+			return true;
+		}
+		else
+		{
+#if ECF_LOGS
+			UE_LOG(LogECF, Error, TEXT("ECF - [%s] For Each Time Sliced failed to start. Are you sure the Budget is greater than 0 and the Item Function is set properly?"), *Settings->Label);
+#endif
+			return false;
+		}
+	}
+
+	bool Setup(int32 InNum, float InBudgetMs, TUniqueFunction<void(int32)>&& InItemFunc, TUniqueFunction<void()>&& InDoneFunc)
+	{
+		DoneFunc_NoStopped = MoveTemp(InDoneFunc);
+		return Setup(InNum, InBudgetMs, MoveTemp(InItemFunc), [this](bool bStopped)
+		{
+			if (DoneFunc_NoStopped)
+			{
+				DoneFunc_NoStopped();
+			}
+		});
+	}
+
+	bool Reset(bool bCallUpdate) override
+	{
+		NextIndex = 0;
+		return true;
+	}
+
+	void Tick(float DeltaTime) override
+	{
+#if STATS
+		DECLARE_SCOPE_CYCLE_COUNTER(TEXT("ForEachTimeSliced - Tick"), STAT_ECFDETAILS_FOREACHTIMESLICED, STATGROUP_ECFDETAILS);
+#endif
+
+#if ECF_INSIGHT_PROFILING
+		TRACE_CPUPROFILER_EVENT_SCOPE("ECF - ForEachTimeSliced Tick");
+#endif
+
+		if (NextIndex >= Num)
+		{
+			MarkAsFinished();
+			Complete(false);
+			return;
+		}
+
+		// Process items in chunks sized to fit the remaining budget, so the clock is not read after every item.
+		// At least one item is processed every tick, even if it is more expensive than the whole budget.
+		const uint64 StartCycles = FPlatformTime::Cycles64();
+		uint64 ElapsedCycles = 0;
+		do
+		{
+			int32 ChunkSize = 1;
+			if (AverageItemCycles > 0.0)
+			{
+				const double ItemsThatFit = static_cast<double>(BudgetCycles - ElapsedCycles) / AverageItemCycles;
+				ChunkSize = static_cast<int32>(FMath::Clamp(ItemsThatFit, 1.0, static_cast<double>(Num - NextIndex)));
+			}
+
+			const uint64 ChunkStartCycles = FPlatformTime::Cycles64();
+			const int32 ChunkEnd = NextIndex + ChunkSize;
+			while (NextIndex < ChunkEnd)
+			{
+				ItemFunc(NextIndex++);
+
+				// The item function can stop this action.
+				if (IsValid() == false)
+				{
+					return;
+				}
+			}
+			const uint64 NowCycles = FPlatformTime::Cycles64();
+
+			const double ChunkItemCycles = static_cast<double>(NowCycles - ChunkStartCycles) / ChunkSize;
+			AverageItemCycles = AverageItemCycles > 0.0 ? FMath::Lerp(AverageItemCycles, ChunkItemCycles, 0.25) : ChunkItemCycles;
+			ElapsedCycles = NowCycles - StartCycles;
+		} 
+		while (NextIndex < Num && ElapsedCycles < BudgetCycles);
+
+		if (NextIndex >= Num)
+		{
+			MarkAsFinished();
+			Complete(false);
+		}
+	}
+
+	float GetActionProgress() const override
+	{
+		return Num > 0 ? static_cast<float>(NextIndex) / Num : 1.f;
+	}
+
+	void Complete(bool bStopped) override
+	{
+		if (DoneFunc)
+		{
+			DoneFunc(bStopped);
+		}
+	}
+};
+
+ECF_PRAGMA_ENABLE_OPTIMIZATION
\ No newline at end of file
@@ -28,7 +28,7 @@ protected:
 		if (InObjectsToLoad.Num() == 0)
 		{
 #if ECF_LOGS
-			UE_LOG(LogECF, Error, TEXT("ECF - [%s] Load Objects Async failed to start. Objects array is empty."), *Settings.Label);
+			UE_LOG(LogECF, Error, TEXT("ECF - [%s] Load Objects Async failed to start. Objects array is empty."), *Settings->Label);
 #endif
 			return false;
 		}
@@ -36,7 +36,7 @@ protected:
 		if (!InCallbackFunc)
 		{
 #if ECF_LOGS
-			UE_LOG(LogECF, Error, TEXT("ECF - [%s] Load Objects Async failed to start. Callback function is not set."), *Settings.Label);
+			UE_LOG(LogECF, Error, TEXT("ECF - [%s] Load Objects Async failed to start. Callback function is not set."), *Settings->Label);
 #endif
 			return false;
 		}
@@ -47,7 +47,7 @@ protected:
 
 
 #if ECF_LOGS
-		UE_LOG(LogECF, Log, TEXT("ECF - [%s] Loading %d objects asynchronously."), *Settings.Label, ObjectsToLoad.Num());
+		UE_LOG(LogECF, Log, TEXT("ECF - [%s] Loading %d objects asynchronously."), *Settings->Label, ObjectsToLoad.Num());
 #endif
 
 		return true;
@@ -66,7 +66,7 @@ protected:
 		else
 		{
 #if ECF_LOGS
-			UE_LOG(LogECF, Error, TEXT("ECF - [%s] Load Objects Async failed to start. Callback function is not set."), *Settings.Label);
+			UE_LOG(LogECF, Error, TEXT("ECF - [%s] Load Objects Async failed to start. Callback function is not set."), *Settings->Label);
 #endif
 			return false;
 		}
@@ -84,7 +84,7 @@ protected:
 					if (StrongThis->IsValid())
 					{
 #if ECF_LOGS
-						UE_LOG(LogECF, Log, TEXT("ECF - [%s] Finished loading %d objects."), *StrongThis->Settings.Label, StrongThis->ObjectsToLoad.Num());
+						UE_LOG(LogECF, Log, TEXT("ECF - [%s] Finished loading %d objects."), *StrongThis->Settings->Label, StrongThis->ObjectsToLoad.Num());
 #endif
 						StrongThis->MarkAsFinished();
 						StrongThis->Complete(false);
@@ -0,0 +1,238 @@
+// Copyright (c) 2026 Damian Nowakowski. All rights reserved.
+
+#pragma once
+
+#include "ECFActionBase.h"
+#include "Templates/Atomic.h"
+#include "Async/Async.h"
+#include "ECFTypes.h"
+#include "ECFCancellationToken.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "ECFParallelForThen.generated.h"
+
+ECF_PRAGMA_DISABLE_OPTIMIZATION
+
+UCLASS()
+class ENHANCEDCODEFLOW_API UECFParallelForThen : public UECFActionBase
+{
+	GENERATED_BODY()
+
+	friend class UECFSubsystem;
+
+protected:
+
+	TUniqueFunction<void(bool, bool)> Func;
+
+	float TimeOut = 0.f;
+	float OriginTimeOut = 0.f;
+	bool bWithTimeOut = false;
+	bool bTimedOut = false;
+
+	ENamedThreads::Type ThreadType = ENamedThreads::AnyBackgroundThreadNormalTask;
+
+	// State shared with the workers. Workers never touch the action, so they can outlive it.
+	struct FBatches
+	{
+		TUniqueFunction<void(int32)> BodyFunc;
+
+		// Range of indices split into batches.
+		int32 Num = 0;
+		int32 BatchSize = 1;
+		int32 BatchesCount = 0;
+
+		// Index of the next batch to process. Workers take batches until there are none left.
+		TAtomic<int32> NextBatch = 0;
+
+		// Completion counter. The worker finishing the last batch wakes up the action.
+		TAtomic<int32> RemainingBatches = 0;
+		TAtomic<bool> bAreAllBatchesDone = false;
+	};
+	TSharedPtr<FBatches, ESPMode::ThreadSafe> Batches;
+
+	// Cancelled when this action is stopped, timed out or removed, so workers stop taking batches.
+	FECFCancellationToken CancellationToken;
+
+	bool Setup(int32 InNum, TUniqueFunction<void(int32)>&& InBodyFunc, TUniqueFunction<void(bool, bool)>&& InFunc, int32 InBatchSize, float InTimeOut, EECFAsyncPrio ThreadPriority)
+	{
+		Func = MoveTemp(InFunc);
+
+		switch (ThreadPriority)
+		{
+			case EECFAsyncPrio::Normal:
+				ThreadType = ENamedThreads::AnyBackgroundThreadNormalTask;
+				break;
+			case EECFAsyncPrio::HiPriority:
+				ThreadType = ENamedThreads::AnyBackgroundHiPriTask;
+				break;
+		}
+
+		if (InBodyFunc && Func && InNum >= 0)
+		{
+			if (InTimeOut > 0.f)
+			{
+				bWithTimeOut = true;
+				bTimedOut = false;
+				TimeOut = InTimeOut;
+				OriginTimeOut = InTimeOut;
+			}
+			else
+			{
+				bWithTimeOut = false;
+				bTimedOut = false;
+			}
+
+			Batches = MakeShared<FBatches, ESPMode::ThreadSafe>();
+			Batches->BodyFunc = MoveTemp(InBodyFunc);
+			Batches->Num = InNum;
+			Batches->BatchSize = FMath::Max(InBatchSize, 1);
+			Batches->BatchesCount = FMath::DivideAndRoundUp(Batches->Num, Batches->BatchSize);
+			Batches->RemainingBatches = Batches->BatchesCount;
+			Batches->bAreAllBatchesDone = Batches->BatchesCount == 0;
+
+			// Don't start more tasks than there are workers. Every task takes batches until there are none left.
+			const int32 TasksCount = FMath::Min(Batches->BatchesCount, FMath::Max(FTaskGraphInterface::Get().GetNumWorkerThreads(), 1));
+
+			// The action is parked while waiting for the batches, so it must be woken up when they are done.
+			// Tasks are started through the async lane and pipe of the action, if it has them.
+			const FECFAsyncCompletion AsyncCompletion = GetAsyncCompletion();
+			for (int32 TaskIndex = 0; TaskIndex < TasksCount; TaskIndex++)
+			{
+				LaunchAsyncTask(ThreadType, [SharedBatches = Batches, AsyncCompletion, Token = CancellationToken]()
+				{
+					RunBatches(*SharedBatches, Token, AsyncCompletion);
+				});
+			}
+
+			return true;
+		}
+		else
+		{
+#if ECF_LOGS
+			UE_LOG(LogECF, Error, TEXT("ECF - [%s] Parallel For Then failed to start. Are you sure the Num, Body and Function are set properly?"), *Settings->Label);
+#endif
+			return false;
+		}
+	}
+
+	bool Setup(int32 InNum, TUniqueFunction<void(int32)>&& InBodyFunc, TUniqueFunction<void(bool)>&& InFunc, int32 InBatchSize, float InTimeOut, EECFAsyncPrio ThreadPriority)
+	{
+		if (InFunc)
+		{
+			return Setup(InNum, MoveTemp(InBodyFunc), [Func_NoStopped = MoveTemp(InFunc)](bool bTimeOut, bool bStopped)
+			{
+				Func_NoStopped(bTimeOut);
+			}, InBatchSize, InTimeOut, ThreadPriority);
+		}
+		else
+		{
+#if ECF_LOGS
+			UE_LOG(LogECF, Error, TEXT("ECF - [%s] Parallel For Then failed to start. Are you sure the Function is set properly?"), *Settings->Label);
+#endif
+			return false;
+		}
+	}
+
+	bool Setup(int32 InNum, TUniqueFunction<void(int32)>&& InBodyFunc, TUniqueFunction<void()>&& InFunc, int32 InBatchSize, float InTimeOut, EECFAsyncPrio ThreadPriority)
+	{
+		if (InFunc)
+		{
+			return Setup(InNum, MoveTemp(InBodyFunc), [Func_NoTimeOut_NoStopped = MoveTemp(InFunc)](bool bTimeOut, bool bStopped)
+			{
+				Func_NoTimeOut_NoStopped();
+			}, InBatchSize, InTimeOut, ThreadPriority);
+		}
+		else
+		{
+#if ECF_LOGS
+			UE_LOG(LogECF, Error, TEXT("ECF - [%s] Parallel For Then failed to start. Are you sure the Function is set properly?"), *Settings->Label);
+#endif
+			return false;
+		}
+	}
+
+	// Processes batches on the worker thread until there are none left or the action is cancelled.
+	static void RunBatches(FBatches& InBatches, const FECFCancellationToken& Token, const FECFAsyncCompletion& AsyncCompletion)
+	{
+		while (Token.IsCancelled() == false)
+		{
+			const int32 Batch = InBatches.NextBatch++;
+			if (Batch >= InBatches.BatchesCount)
+			{
+				return;
+			}
+
+			const int32 BatchEnd = FMath::Min((Batch + 1) * InBatches.BatchSize, InBatches.Num);
+			for (int32 Index = Batch * InBatches.BatchSize; Index < BatchEnd; Index++)
+			{
+				InBatches.BodyFunc(Index);
+			}
+
+			if (--InBatches.RemainingBatches == 0)
+			{
+				InBatches.bAreAllBatchesDone = true;
+				AsyncCompletion.Signal();
+			}
+		}
+	}
+
+	bool Reset(bool bCallUpdate) override
+	{
+		if (bWithTimeOut)
+		{
+			TimeOut = OriginTimeOut;
+
+			// Restart the deadline of the waiting action.
+			if (IsParked())
+			{
+				Park(TimeOut);
+			}
+		}
+		return true;
+	}
+
+	void Tick(float DeltaTime) override
+	{
+#if STATS
+		DECLARE_SCOPE_CYCLE_COUNTER(TEXT("ParallelForThen - Tick"), STAT_ECFDETAILS_PARALLELFORTHEN, STATGROUP_ECFDETAILS);
+#endif
+
+#if ECF_INSIGHT_PROFILING
+		TRACE_CPUPROFILER_EVENT_SCOPE("ECF - ParallelForThen Tick");
+#endif
+
+		if (Batches->bAreAllBatchesDone)
+		{
+			MarkAsFinished();
+			Complete(false);
+			return;
+		}
+
+		// Don't poll the batches every tick. Wait for them without ticking until they are done or until the time out passes.
+		Park(bWithTimeOut ? TimeOut : 0.f);
+	}
+
+	void DeadlineReached() override
+	{
+		CancellationToken.Cancel();
+		bTimedOut = true;
+		MarkAsFinished();
+		Complete(false);
+	}
+
+	void Removed() override
+	{
+		CancellationToken.Cancel();
+	}
+
+	void Complete(bool bStopped) override
+	{
+		if (bStopped)
+		{
+			CancellationToken.Cancel();
+		}
+
+		Func(bTimedOut, bStopped);
+	}
+};
+
+ECF_PRAGMA_ENABLE_OPTIMIZATION
\ No newline at end of file
@@ -3,9 +3,10 @@
 #pragma once
 
 #include "ECFActionBase.h"
-#include "Templates/Atomic.h"
 #include "Async/Async.h"
 #include "ECFTypes.h"
+#include "ECFCancellationToken.h"
+#include "ECFAsyncJob.h"
 #include "Async/TaskGraphInterfaces.h"
 #include "ECFRunAsyncThen.generated.h"
 
@@ -20,10 +21,8 @@ class ENHANCEDCODEFLOW_API UECFRunAsyncThen : public UECFActionBase
 
 protected:
 
-	TUniqueFunction<void()> AsyncTaskFunc;
-	TUniqueFunction<void(bool, bool)> Func;
-	TUniqueFunction<void(bool)> Func_NoStopped;
-	TUniqueFunction<void()> Func_NoTimeOut_NoStopped;
+	// Task, its result and the callback.
+	FECFAsyncJobPtr AsyncJob;
 
 	float TimeOut = 0.f;
 	float OriginTimeOut = 0.f;
@@ -31,12 +30,13 @@ protected:
 	bool bTimedOut = false;
 
 	ENamedThreads::Type ThreadType = ENamedThreads::AnyBackgroundThreadNormalTask;
-	TAtomic<bool> bIsAsyncTaskDone = false;
 
-	bool Setup(TUniqueFunction<void()>&& InAsyncTaskFunc, TUniqueFunction<void(bool, bool)>&& InFunc, float InTimeOut, EECFAsyncPrio ThreadPriority)
+	// Cancelled when this action is stopped, timed out or removed, so the async task can bail out early.
+	FECFCancellationToken CancellationToken;
+
+	bool Setup(FECFAsyncJobPtr&& InAsyncJob, float InTimeOut, EECFAsyncPrio ThreadPriority)
 	{
-		AsyncTaskFunc = MoveTemp(InAsyncTaskFunc);
-		Func = MoveTemp(InFunc);
+		AsyncJob = MoveTemp(InAsyncJob);
 
 		switch (ThreadPriority)
 		{
@@ -48,7 +48,7 @@ protected:
 				break;
 		}
 
-		if (AsyncTaskFunc && Func)
+		if (AsyncJob.IsValid())
 		{
 			if (InTimeOut > 0.f)	
 			{
@@ -56,7 +56,6 @@ protected:
 				bTimedOut = false;
 				TimeOut = InTimeOut;
 				OriginTimeOut = InTimeOut;
-				SetMaxActionTime(TimeOut);
 			}
 			else
 			{
@@ -64,16 +63,17 @@ protected:
 				bTimedOut = false;
 			}
 
-			bIsAsyncTaskDone = false;
-
-			TWeakObjectPtr<ThisClass> WeakThis(this);
-			AsyncTask(ThreadType, [WeakThis]()
+			// The action is parked while waiting for the async task, so it must be woken up when the task is done.
+			// The worker keeps the job alive by itself and never touches the action.
+			LaunchAsyncTask(ThreadType, [Job = AsyncJob, AsyncCompletion = GetAsyncCompletion(), Token = CancellationToken]()
 			{
-				if (ThisClass* StrongThis = WeakThis.Get())
+				if (Token.IsCancelled())
 				{
-					StrongThis->AsyncTaskFunc();
-					StrongThis->bIsAsyncTaskDone = true;
+					return;
 				}
+
+				Job->Execute(Token);
+				AsyncCompletion.Signal();
 			});
 
 			return true;
@@ -81,45 +81,38 @@ protected:
 		else
 		{
 #if ECF_LOGS
-			UE_LOG(LogECF, Error, TEXT("ECF - [%s] Run Async Task and Run failed to start. Are you sure the AsyncTask and Function are set properly?"), *Settings.Label);
+			UE_LOG(LogECF, Error, TEXT("ECF - [%s] Run Async Task and Run failed to start. Are you sure the AsyncTask and Function are set properly?"), *Settings->Label);
 #endif
 			return false;
 		}
 	}
 
-	bool Setup(TUniqueFunction<void()>&& InAsyncTaskFunc, TUniqueFunction<void(bool)>&& InFunc, float InTimeOut, EECFAsyncPrio ThreadPriority)
+	bool Setup(TUniqueFunction<void(const FECFCancellationToken&)>&& InAsyncTaskFunc, TUniqueFunction<void(bool, bool)>&& InFunc, float InTimeOut, EECFAsyncPrio ThreadPriority)
 	{
-		Func_NoStopped = MoveTemp(InFunc);
-		if (Func_NoStopped)
-		{
-			return Setup(MoveTemp(InAsyncTaskFunc), [this](bool bTimeOut, bool bStopped)
-			{
-				Func_NoStopped(bTimeOut);
-			}, InTimeOut, ThreadPriority);
-		}
-		else
-		{
-#if ECF_LOGS
-			UE_LOG(LogECF, Error, TEXT("ECF - [%s] Run Async Task and Run failed to start. Are you sure the Function is set properly?"), *Settings.Label);
-#endif
-			return false;
-		}
+		return SetupFunctions(MoveTemp(InAsyncTaskFunc), MoveTemp(InFunc), InTimeOut, ThreadPriority);
+	}
+
+	bool Setup(TUniqueFunction<void(const FECFCancellationToken&)>&& InAsyncTaskFunc, TUniqueFunction<void(bool)>&& InFunc, float InTimeOut, EECFAsyncPrio ThreadPriority)
+	{
+		return SetupFunctions(MoveTemp(InAsyncTaskFunc), MoveTemp(InFunc), InTimeOut, ThreadPriority);
 	}
 
-	bool Setup(TUniqueFunction<void()>&& InAsyncTaskFunc, TUniqueFunction<void()>&& InFunc, float InTimeOut, EECFAsyncPrio ThreadPriority)
+	bool Setup(TUniqueFunction<void(const FECFCancellationToken&)>&& InAsyncTaskFunc, TUniqueFunction<void()>&& InFunc, float InTimeOut, EECFAsyncPrio ThreadPriority)
 	{
-		Func_NoTimeOut_NoStopped = MoveTemp(InFunc);
-		if (Func_NoTimeOut_NoStopped)
+		return SetupFunctions(MoveTemp(InAsyncTaskFunc), MoveTemp(InFunc), InTimeOut, ThreadPriority);
+	}
+
+	template<typename TFunc>
+	bool SetupFunctions(TUniqueFunction<void(const FECFCancellationToken&)>&& InAsyncTaskFunc, TFunc&& InFunc, float InTimeOut, EECFAsyncPrio ThreadPriority)
+	{
+		if (InAsyncTaskFunc && InFunc)
 		{
-			return Setup(MoveTemp(InAsyncTaskFunc), [this](bool bTimeOut, bool bStopped)
-			{
-				Func_NoTimeOut_NoStopped();
-			}, InTimeOut, ThreadPriority);
+			return Setup(MakeECFAsyncJob<void>(MoveTemp(InAsyncTaskFunc), MoveTemp(InFunc)), InTimeOut, ThreadPriority);
 		}
 		else
 		{
 #if ECF_LOGS
-			UE_LOG(LogECF, Error, TEXT("ECF - [%s] Run Async Task and Run failed to start. Are you sure the Function is set properly?"), *Settings.Label);
+			UE_LOG(LogECF, Error, TEXT("ECF - [%s] Run Async Task and Run failed to start. Are you sure the AsyncTask and Function are set properly?"), *Settings->Label);
 #endif
 			return false;
 		}
@@ -130,6 +123,12 @@ protected:
 		if (bWithTimeOut)
 		{
 			TimeOut = OriginTimeOut;
+
+			// Restart the deadline of the waiting action.
+			if (IsParked())
+			{
+				Park(TimeOut);
+			}
 		}
 		return true;
 	}
@@ -144,28 +143,38 @@ protected:
 		TRACE_CPUPROFILER_EVENT_SCOPE("ECF - RunAsyncThen Tick");
 #endif
 
-		if (bWithTimeOut)
-		{
-			TimeOut -= DeltaTime;
-			if (TimeOut <= 0.f)
-			{
-				bTimedOut = true;
-				MarkAsFinished();
-				Complete(false);
-				return;
-			}
-		}
-
-		if (bIsAsyncTaskDone)
+		if (AsyncJob->IsDone())
 		{
 			MarkAsFinished();
 			Complete(false);
+			return;
 		}
+
+		// Don't poll the async task every tick. Wait for it without ticking until it is done or until the time out passes.
+		Park(bWithTimeOut ? TimeOut : 0.f);
+	}
+
+	void DeadlineReached() override
+	{
+		CancellationToken.Cancel();
+		bTimedOut = true;
+		MarkAsFinished();
+		Complete(false);
+	}
+
+	void Removed() override
+	{
+		CancellationToken.Cancel();
 	}
 
 	void Complete(bool bStopped) override
 	{
-		Func(bTimedOut, bStopped);
+		if (bStopped)
+		{
+			CancellationToken.Cancel();
+		}
+
+		AsyncJob->Finish(AsyncJob->IsDone(), bTimedOut, bStopped);
 	}
 };
 
@@ -0,0 +1,280 @@
+// Copyright (c) 2026 Damian Nowakowski. All rights reserved.
+
+#pragma once
+
+#include "ECFActionBase.h"
+#include "Templates/Atomic.h"
+#include "Async/Async.h"
+#include "ECFTypes.h"
+#include "ECFCancellationToken.h"
+#include "ECFPipelineTypes.h"
+#include "Engine/AssetManager.h"
+#include "HAL/PlatformTime.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "ECFRunPipeline.generated.h"
+
+ECF_PRAGMA_DISABLE_OPTIMIZATION
+
+UCLASS()
+class ENHANCEDCODEFLOW_API UECFRunPipeline : public UECFActionBase
+{
+	GENERATED_BODY()
+
+	friend class UECFSubsystem;
+
+protected:
+
+	// State shared with the worker running the worker stages. The worker never touches the action,
+	// so the payload, the stage cursor and the report stay valid even if the action is gone before the worker ends.
+	struct FState
+	{
+		FECFPipeline Pipeline;
+		FECFPipelineReport Report;
+
+		// Index of the stage to run next (or the running one). Only the Game Thread or the running worker advance it.
+		TAtomic<int32> CurrentStage = 0;
+
+		// Set when the awaited stages have finished.
+		TAtomic<bool> bIsStageDone = false;
+
+		double StartTime = 0.0;
+		FString Label;
+
+		void BeginStage()
+		{
+			Report.Stages[CurrentStage].StartTime = FPlatformTime::Seconds() - StartTime;
+		}
+
+		void EndStage()
+		{
+			FECFPipelineStageTiming& Timing = Report.Stages[CurrentStage];
+			Timing.Duration = FPlatformTime::Seconds() - StartTime - Timing.StartTime;
+
+#if (ECF_LOGS && ECF_LOGS_VERBOSE)
+			UE_LOG(LogECF, Log, TEXT("ECF - [%s] Pipeline stage %s finished in %f seconds."), *Label, *Timing.Name.ToString(), Timing.Duration);
+#endif
+
+			CurrentStage++;
+		}
+	};
+	TSharedPtr<FState, ESPMode::ThreadSafe> State;
+
+	ENamedThreads::Type ThreadType = ENamedThreads::AnyBackgroundThreadNormalTask;
+
+	// Indicates if the pipeline waits for worker stages or assets loading. 
+	bool bIsWaitingForStage = false;
+
+	// Indicates if the pipeline waits for worker stages, which use the payload.
+	bool bIsWaitingForWorker = false;
+
+	// The first stage run by the workers. Stages before it are safe to report from the Game Thread.
+	int32 FirstWorkerStage = 0;
+
+	TSharedPtr<FStreamableHandle> StreamableHandle;
+
+	// Cancelled when this action is stopped or removed, so worker stages can bail out early.
+	FECFCancellationToken CancellationToken;
+
+	bool Setup(FECFPipeline&& InPipeline, EECFAsyncPrio ThreadPriority)
+	{
+		State = MakeShared<FState, ESPMode::ThreadSafe>();
+		State->Pipeline = MoveTemp(InPipeline);
+		State->Label = Settings->Label;
+
+		switch (ThreadPriority)
+		{
+			case EECFAsyncPrio::Normal:
+				ThreadType = ENamedThreads::AnyBackgroundThreadNormalTask;
+				break;
+			case EECFAsyncPrio::HiPriority:
+				ThreadType = ENamedThreads::AnyBackgroundHiPriTask;
+				break;
+		}
+
+		FECFPipeline& Pipeline = State->Pipeline;
+		if (Pipeline.IsValid())
+		{
+			FECFPipelineReport& Report = State->Report;
+			Report.Stages.SetNum(Pipeline.Stages.Num());
+			for (int32 StageIndex = 0; StageIndex < Pipeline.Stages.Num(); StageIndex++)
+			{
+				Report.Stages[StageIndex].Name = Pipeline.Stages[StageIndex].Name;
+				Report.Stages[StageIndex].Context = Pipeline.Stages[StageIndex].Context;
+			}
+			return true;
+		}
+		else
+		{
+#if ECF_LOGS
+			UE_LOG(LogECF, Error, TEXT("ECF - [%s] Run Pipeline failed to start. Are you sure the Pipeline has stages and the Callback is set?"), *Settings->Label);
+#endif
+			return false;
+		}
+	}
+
+	void Init() override
+	{
+		State->StartTime = FPlatformTime::Seconds();
+	}
+
+	void Tick(float DeltaTime) override
+	{
+#if STATS
+		DECLARE_SCOPE_CYCLE_COUNTER(TEXT("RunPipeline - Tick"), STAT_ECFDETAILS_RUNPIPELINE, STATGROUP_ECFDETAILS);
+#endif
+
+#if ECF_INSIGHT_PROFILING
+		TRACE_CPUPROFILER_EVENT_SCOPE("ECF - RunPipeline Tick");
+#endif
+
+		// Keep advancing as long as the started stages finish right away.
+		while (bIsWaitingForStage == false || State->bIsStageDone)
+		{
+			bIsWaitingForStage = false;
+			bIsWaitingForWorker = false;
+			if (AdvanceStages())
+			{
+				return;
+			}
+		}
+
+		// Don't poll the stages every tick. Wait for them without ticking until they are done.
+		Park();
+	}
+
+	// Runs stages until the pipeline ends or a stage must be awaited. Returns true if the pipeline has ended.
+	bool AdvanceStages()
+	{
+		while (State->CurrentStage < State->Pipeline.Stages.Num())
+		{
+			switch (State->Pipeline.Stages[State->CurrentStage].Context)
+			{
+				case EECFPipelineContext::GameThread:
+					State->BeginStage();
+					State->Pipeline.Stages[State->CurrentStage].Run(CancellationToken);
+					State->EndStage();
+					break;
+
+				case EECFPipelineContext::Worker:
+					StartWorkerStages();
+					return false;
+
+				case EECFPipelineContext::LoadAssets:
+					if (StartLoadingAssets())
+					{
+						return false;
+					}
+					break;
+			}
+
+			// Game Thread stages can stop the pipeline.
+			if (IsValid() == false)
+			{
+				return true;
+			}
+		}
+
+		MarkAsFinished();
+		Complete(false);
+		return true;
+	}
+
+	// Starts all consecutive worker stages. They run one after another on the same worker.
+	void StartWorkerStages()
+	{
+		bIsWaitingForStage = true;
+		bIsWaitingForWorker = true;
+		State->bIsStageDone = false;
+		FirstWorkerStage = State->CurrentStage;
+
+		// The action is parked while waiting for the worker, so it must be woken up when the stages are done.
+		// The Game Thread doesn't touch the payload or the cursor until the worker sets bIsStageDone.
+		LaunchAsyncTask(ThreadType, [SharedState = State, AsyncCompletion = GetAsyncCompletion(), Token = CancellationToken]()
+		{
+			if (Token.IsCancelled())
+			{
+				return;
+			}
+
+			FState& WorkerState = *SharedState;
+			while (WorkerState.CurrentStage < WorkerState.Pipeline.Stages.Num() &&
+				WorkerState.Pipeline.Stages[WorkerState.CurrentStage].Context == EECFPipelineContext::Worker &&
+				Token.IsCancelled() == false)
+			{
+				WorkerState.BeginStage();
+				WorkerState.Pipeline.Stages[WorkerState.CurrentStage].Run(Token);
+				WorkerState.EndStage();
+			}
+			WorkerState.bIsStageDone = true;
+			AsyncCompletion.Signal();
+		});
+	}
+
+	// Starts loading the assets of the current stage. Returns false if there is nothing to load.
+	bool StartLoadingAssets()
+	{
+		State->BeginStage();
+
+		TArray<FSoftObjectPath> AssetsToLoad = State->Pipeline.Stages[State->CurrentStage].GetAssets();
+		if (AssetsToLoad.Num() == 0)
+		{
+			State->EndStage();
+			return false;
+		}
+
+		bIsWaitingForStage = true;
+		State->bIsStageDone = false;
+
+		TWeakObjectPtr<ThisClass> WeakThis(this);
+		FStreamableManager& StreamableManager = UAssetManager::GetStreamableManager();
+		StreamableHandle = StreamableManager.RequestAsyncLoad(AssetsToLoad,
+			[WeakThis, AsyncCompletion = GetAsyncCompletion()]()
+			{
+				if (ThisClass* StrongThis = WeakThis.Get())
+				{
+					if (StrongThis->bIsWaitingForStage && StrongThis->State->bIsStageDone == false)
+					{
+						StrongThis->State->EndStage();
+						StrongThis->State->bIsStageDone = true;
+						AsyncCompletion.Signal();
+					}
+				}
+			}
+		);
+		return true;
+	}
+
+	void Removed() override
+	{
+		CancellationToken.Cancel();
+	}
+
+	void Complete(bool bStopped) override
+	{
+		if (bStopped)
+		{
+			CancellationToken.Cancel();
+		}
+
+		if (StreamableHandle.IsValid())
+		{
+			if (StreamableHandle->IsActive())
+			{
+				StreamableHandle->CancelHandle();
+			}
+			StreamableHandle.Reset();
+		}
+
+		// If the workers are still running, they use the payload and the timings of their stages.
+		const bool bIsWorkerRunning = bIsWaitingForWorker && State->bIsStageDone == false;
+		FECFPipelineReport FinishedReport;
+		FinishedReport.CompletedStages = bIsWorkerRunning ? FirstWorkerStage : State->CurrentStage.Load();
+		FinishedReport.bStopped = FinishedReport.CompletedStages < State->Pipeline.Stages.Num();
+		FinishedReport.TotalTime = FPlatformTime::Seconds() - State->StartTime;
+		FinishedReport.Stages.Append(State->Report.Stages.GetData(), FinishedReport.CompletedStages);
+
+		State->Pipeline.Callback(bIsWorkerRunning == false, FinishedReport);
+	}
+};
+
+ECF_PRAGMA_ENABLE_OPTIMIZATION
\ No newline at end of file
@@ -43,7 +43,7 @@ protected:
 		else
 		{
 #if ECF_LOGS
-			UE_LOG(LogECF, Error, TEXT("ECF - [%s] ticker failed to start. Are you sure the Ticking time is greater than 0 and Ticking Function are set properly?"), *Settings.Label);
+			UE_LOG(LogECF, Error, TEXT("ECF - [%s] ticker failed to start. Are you sure the Ticking time is greater than 0 and Ticking Function are set properly?"), *Settings->Label);
 #endif
 			return false;
 		}
@@ -124,8 +124,7 @@ protected:
 
 		if (TickingTime > 0.f && CurrentTime >= TickingTime)
 		{
-			MarkAsFinished();
-			Complete(false);
+			FinishAndComplete();
 		}
 	}
 
@@ -137,6 +136,11 @@ protected:
 		}
 	}
 
+	bool SupportsThreadSafeTick() const override
+	{
+		return true;
+	}
+
 	float GetActionTime() const override
 	{
 		return CurrentTime;
@@ -149,8 +153,7 @@ protected:
 		{
 			if (TickingTime > 0.f && CurrentTime >= TickingTime)
 			{
-				MarkAsFinished();
-				Complete(false);
+				FinishAndComplete();
 			}
 		}
 		return true;
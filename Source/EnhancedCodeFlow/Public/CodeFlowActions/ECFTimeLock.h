@@ -18,7 +18,6 @@ protected:
 
 	TUniqueFunction<void()> ExecFunc;
 	float LockTime = 0.f;
-	float CurrentTime = 0.f;
 
 	bool Setup(float InLockTime, TUniqueFunction<void()>&& InExecFunc)
 	{
@@ -27,30 +26,36 @@ protected:
 
 		if (ExecFunc && LockTime > 0)
 		{
-			SetMaxActionTime(LockTime);
 			return true;
 		}
 		else
 		{
 #if ECF_LOGS
-			UE_LOG(LogECF, Error, TEXT("ECF - [%s] Timelock failed to start. Are you sure the Lock time is greater than 0 and the Exec Function is set properly?"), *Settings.Label);
+			UE_LOG(LogECF, Error, TEXT("ECF - [%s] Timelock failed to start. Are you sure the Lock time is greater than 0 and the Exec Function is set properly?"), *Settings->Label);
 #endif
 			return false;
 		}
 	}
 
+	// The time lock doesn't tick. It waits parked until its deadline passes.
 	void Init() override
 	{
-		CurrentTime = 0;
 		ExecFunc();
+		WaitForActionTime(LockTime);
 	}
 
 	bool Reset(bool bCallUpdate) override
 	{
-		CurrentTime = 0.f;
+		WaitForActionTime(LockTime);
 		return true;
 	}
 
+	void DeadlineReached() override
+	{
+		MarkAsFinished();
+	}
+
+	// Ticked only when there was no time to wait for.
 	void Tick(float DeltaTime) override
 	{
 #if STATS
@@ -61,27 +66,23 @@ protected:
 		TRACE_CPUPROFILER_EVENT_SCOPE("ECF - TimeLock Tick");
 #endif
 
-		CurrentTime += DeltaTime;
-		if (CurrentTime >= LockTime)
-		{
-			MarkAsFinished();
-		}
+		MarkAsFinished();
 	}
 
 	float GetActionTime() const override
 	{
-		return CurrentTime;
+		return GetWaitedActionTime();
 	}
 
 	bool SetActionTime(float NewTime, bool bCallUpdate) override
 	{
-		CurrentTime = NewTime;
-		if (bCallUpdate)
+		if (bCallUpdate && NewTime >= LockTime)
+		{
+			MarkAsFinished();
+		}
+		else
 		{
-			if(CurrentTime >= LockTime)
-			{
-				MarkAsFinished();
-			}
+			WaitForActionTime(LockTime, NewTime);
 		}
 		return true;
 	}
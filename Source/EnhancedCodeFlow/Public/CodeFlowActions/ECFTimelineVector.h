@@ -49,6 +49,10 @@ protected:
 	float CurrentTime;
 	FVector CurrentValue;
 
+	// Values and times computed in the parallel compute phase, waiting to be applied on the Game Thread.
+	// Catching up with many intervals (FireAll) computes many of them in one tick.
+	TArray<TPair<FVector, float>, TInlineAllocator<1>> ComputedTicks;
+
 	bool Setup(FVector InStartValue, FVector InStopValue, float InTime, TUniqueFunction<void(FVector, float)>&& InTickFunc, TUniqueFunction<void(FVector, float, bool)>&& InCallbackFunc, EECFBlendFunc InBlendFunc, float InBlendExp)
 	{
 		StartValue = InStartValue;
@@ -70,7 +74,7 @@ protected:
 		else
 		{
 #if ECF_LOGS
-			UE_LOG(LogECF, Error, TEXT("ECF - [%s] Timeline Vector failed to start. Are you sure the Ticking time is greater than 0 and Ticking Function are set properly? /n Remember, that BlendExp must be different than zero and StartValue and StopValue must not be the same!"), *Settings.Label);
+			UE_LOG(LogECF, Error, TEXT("ECF - [%s] Timeline Vector failed to start. Are you sure the Ticking time is greater than 0 and Ticking Function are set properly? /n Remember, that BlendExp must be different than zero and StartValue and StopValue must not be the same!"), *Settings->Label);
 #endif
 			return false;
 		}
@@ -113,13 +117,40 @@ protected:
 
 		CurrentTime = FMath::Clamp(CurrentTime + DeltaTime, 0.f, Time);
 		CurrentValue = GetValue();
-		
-		TickFunc(CurrentValue, CurrentTime);
+
+		// In the parallel compute phase the value is applied later on the Game Thread.
+		if (DeferTickApply())
+		{
+			ComputedTicks.Emplace(CurrentValue, CurrentTime);
+			return;
+		}
+		ApplyTick();
+	}
+
+	void ApplyTick() override
+	{
+		if (ComputedTicks.Num() > 0)
+		{
+			for (const TPair<FVector, float>& ComputedTick : ComputedTicks)
+			{
+				TickFunc(ComputedTick.Key, ComputedTick.Value);
+
+				// The tick function can stop this action. Ticks computed after the end of the timeline are dropped.
+				if (IsValid() == false || ComputedTick.Value >= Time)
+				{
+					break;
+				}
+			}
+			ComputedTicks.Reset();
+		}
+		else
+		{
+			TickFunc(CurrentValue, CurrentTime);
+		}
 
 		if (CurrentTime >= Time)
 		{
-			MarkAsFinished();
-			Complete(false);
+			FinishAndComplete();
 		}
 	}
 
@@ -131,6 +162,16 @@ protected:
 		}
 	}
 
+	bool SupportsThreadSafeTick() const override
+	{
+		return true;
+	}
+
+	bool SupportsParallelCompute() const override
+	{
+		return true;
+	}
+
 	float GetActionTime() const override
 	{
 		return CurrentTime;
@@ -145,8 +186,7 @@ protected:
 			TickFunc(CurrentValue, CurrentTime);
 			if (CurrentTime >= Time)
 			{
-				MarkAsFinished();
-				Complete(false);
+				FinishAndComplete();
 			}
 		}
 		return true;
@@ -5,6 +5,9 @@
 #include "ECFCoroutine.h"
 #include "ECFSubsystem.h"
 #include "ECFTypes.h"
+#include "ECFCancellationToken.h"
+#include "ECFSignal.h"
+#include "ECFAsyncJob.h"
 
 class ENHANCEDCODEFLOW_API FECFCoroutineAwaiter
 {
@@ -152,6 +155,49 @@ private:
 	float TimeOut = 0.f;
 };
 
+/*^^^ Wait For Signal Coroutine Awaiter ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^*/
+
+class ENHANCEDCODEFLOW_API FECFCoroutineAwaiter_WaitForSignal : public FECFCoroutineAwaiter
+{
+public:
+
+	// C-tor
+	FECFCoroutineAwaiter_WaitForSignal(const UObject* InOwner, const FECFActionSettings& InSettings, const FECFSignal& InSignal, float InTimeOut);
+
+	// Doesn't suspend the coroutine if the signal is already set.
+	bool await_ready()
+	{
+		bWasSet = Signal.IsSet();
+		return bWasSet;
+	}
+
+	// Called when the suspension begins
+	void await_suspend(FECFCoroutineHandle InCoroHandle);
+
+	// Returns the state of the corotuine after it's resumed.
+	FECFCoroutineAwaiter_ResultWithTimeout await_resume()
+	{
+		// The coroutine hasn't been suspended, so there is no action and its results.
+		if (bWasSet)
+		{
+			return FECFCoroutineAwaiter_ResultWithTimeout(false, false);
+		}
+
+		return FECFCoroutineAwaiter_ResultWithTimeout(
+			CoroHandle.promise().bStopped,
+			CoroHandle.promise().bTimedOut);
+	}
+
+private:
+
+	// Storing values in order to use them when await_suspend is called
+	FECFSignal Signal;
+	float TimeOut = 0.f;
+
+	// Indicates if the signal has been already set when the coroutine started awaiting it.
+	bool bWasSet = false;
+};
+
 /*^^^ Run Async And Wait Coroutine Awaiter ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^*/
 
 class ENHANCEDCODEFLOW_API FECFCoroutineAwaiter_RunAsyncAndWait : public FECFCoroutineAwaiter
@@ -159,7 +205,7 @@ class ENHANCEDCODEFLOW_API FECFCoroutineAwaiter_RunAsyncAndWait : public FECFCor
 public:
 
 	// C-tor
-	FECFCoroutineAwaiter_RunAsyncAndWait(const UObject* InOwner, const FECFActionSettings& InSettings, TUniqueFunction<void()>&& InAsyncTaskFunc, float InTimeOut, EECFAsyncPrio InThreadPriority);
+	FECFCoroutineAwaiter_RunAsyncAndWait(const UObject* InOwner, const FECFActionSettings& InSettings, TUniqueFunction<void(const FECFCancellationToken&)>&& InAsyncTaskFunc, float InTimeOut, EECFAsyncPrio InThreadPriority);
 
 	// Called when the suspension begins
 	void await_suspend(FECFCoroutineHandle InCoroHandle);
@@ -172,14 +218,72 @@ public:
 			CoroHandle.promise().bTimedOut);
 	}
 
-private:
+protected:
+
+	// C-tor for awaiters which create the async job by themselves.
+	FECFCoroutineAwaiter_RunAsyncAndWait(const UObject* InOwner, const FECFActionSettings& InSettings, float InTimeOut, EECFAsyncPrio InThreadPriority);
 
 	// Storing values in order to use them when await_suspend is called
-	TUniqueFunction<void()> AsyncTaskFunction;
+	FECFAsyncJobPtr AsyncJob;
 	float TimeOut = 0.f;
 	EECFAsyncPrio ThreadPriority = EECFAsyncPrio::Normal;
 };
 
+template<typename TResult>
+struct TECFCoroutineAwaiter_ResultWithValue
+{
+	bool bStopped = false;
+	bool bTimedOut = false;
+
+	// Value returned by the async task. Empty if the task hasn't finished (e.g. it has been stopped or timed out).
+	TOptional<TResult> Result;
+
+	TECFCoroutineAwaiter_ResultWithValue(bool InStopped, bool InTimedOut, TOptional<TResult>&& InResult) :
+		bStopped(InStopped),
+		bTimedOut(InTimedOut),
+		Result(MoveTemp(InResult))
+	{
+	}
+};
+
+template<typename TResult, typename TTask>
+class TECFCoroutineAwaiter_RunAsyncAndWait : public FECFCoroutineAwaiter_RunAsyncAndWait
+{
+public:
+
+	// C-tor
+	template<typename TInTask>
+	TECFCoroutineAwaiter_RunAsyncAndWait(const UObject* InOwner, const FECFActionSettings& InSettings, TInTask&& InAsyncTaskFunc, float InTimeOut, EECFAsyncPrio InThreadPriority) :
+		FECFCoroutineAwaiter_RunAsyncAndWait(InOwner, InSettings, InTimeOut, InThreadPriority),
+		AsyncTaskFunction(Forward<TInTask>(InAsyncTaskFunc))
+	{
+	}
+
+	// Called when the suspension begins. The awaiter lives in the coroutine frame now, so the job can move the result directly into it.
+	void await_suspend(FECFCoroutineHandle InCoroHandle)
+	{
+		AsyncJob = MakeECFAsyncJob<TResult>(MoveTemp(AsyncTaskFunction), [this](TOptional<TResult>&& InResult)
+		{
+			Result = MoveTemp(InResult);
+		});
+		FECFCoroutineAwaiter_RunAsyncAndWait::await_suspend(InCoroHandle);
+	}
+
+	// Returns the state of the corotuine and the result of the async task after it's resumed.
+	TECFCoroutineAwaiter_ResultWithValue<TResult> await_resume()
+	{
+		return TECFCoroutineAwaiter_ResultWithValue<TResult>(
+			CoroHandle.promise().bStopped,
+			CoroHandle.promise().bTimedOut,
+			MoveTemp(Result));
+	}
+
+private:
+
+	TTask AsyncTaskFunction;
+	TOptional<TResult> Result;
+};
+
 /*^^^ Wait Load Objects Coroutine Awaiter ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^*/
 
 class ENHANCEDCODEFLOW_API FECFCoroutineAwaiter_WaitLoadObjects : public FECFCoroutineAwaiter
@@ -6,6 +6,8 @@
 #include "ECFHandle.h"
 #include "ECFInstanceId.h"
 #include "ECFActionSettings.h"
+#include "ECFAsyncCompletion.h"
+#include "Async/TaskGraphInterfaces.h"
 #include "ECFStats.h"
 #include "Misc/AssertionMacros.h"
 #include "Engine/World.h"
@@ -36,10 +38,12 @@ public:
 		return Owner.IsValid() && (Owner->HasAnyFlags(RF_BeginDestroyed | RF_FinishDestroyed) == false);
 	}
 
-	// Checks if the action is valid
+	// Checks if the action is valid.
+	// Actions with tracked owner lifetime are invalidated by the subsystem when their owner dies,
+	// so their owner doesn't have to be resolved here.
 	virtual bool IsValid() const
 	{
-		return bHasFinished == false && HasValidOwner();
+		return bHasFinished == false && (bOwnerLifetimeTracked || HasValidOwner());
 	}
 
 	// Returns this action handle id
@@ -55,9 +59,9 @@ public:
 	}
 
 	// Returns this action Label
-	FString GetLabel() const
+	const FString& GetLabel() const
 	{
-		return Settings.Label;
+		return Settings->Label;
 	}
 
 	// Checks if this action is paused
@@ -66,6 +70,12 @@ public:
 		return bIsPaused;
 	}
 
+	// Checks if this action is parked (waits for async work without ticking)
+	bool IsParked() const
+	{
+		return bIsParked;
+	}
+
 	// Checks if this action has this instance id.
 	bool HasInstanceId(const FECFInstanceId& InstanceIdToCheck) const
 	{
@@ -111,6 +121,43 @@ protected:
 		bHasFinished = true;
 	}
 
+	// Checks if this action can be ticked on worker threads when launched with the Thread Safe Tick setting.
+	// The tick of such action must not touch the subsystem nor other actions, and must finish the action with FinishAndComplete.
+	virtual bool SupportsThreadSafeTick() const { return false; }
+
+	// Checks if this action can compute its tick on worker threads when launched with the Parallel Compute setting.
+	// The tick of such action must check DeferTickApply and apply its computed state in ApplyTick.
+	virtual bool SupportsParallelCompute() const { return false; }
+
+	// Checks if the tick is computed on a worker thread in the parallel compute phase. If so, the action should only
+	// compute its new state in the tick. ApplyTick will be called later on the Game Thread.
+	bool DeferTickApply()
+	{
+		bHasTickToApply = bIsComputingTick;
+		return bIsComputingTick;
+	}
+
+	// Applies the state computed by the tick on a worker thread, e.g. calls the tick function. Called on the Game Thread.
+	virtual void ApplyTick() {}
+
+	// Marks this action as finished and completes it. When the action is ticked on a worker thread,
+	// the completion is deferred to the Game Thread phase following the parallel tick.
+	void FinishAndComplete()
+	{
+		MarkAsFinished();
+		if (bIsTickingInParallel)
+		{
+			bIsCompletionDeferred = true;
+		}
+		else
+		{
+			Complete(false);
+		}
+	}
+
+	// Function called when this action is removed from the subsystem, because it has finished or became invalid.
+	virtual void Removed() {}
+
 	// Function called when this action is instanced and something tried to call it again.
 	virtual void RetriggeredInstancedAction() {}
 
@@ -121,6 +168,38 @@ protected:
 	// Return true if the action was resetted, false otherwise.
 	virtual bool Reset(bool bCallUpdate) { return false; }
 
+	// Parks this action. Parked action is not ticked until it is woken up by signaling the completion
+	// obtained from GetAsyncCompletion (from any thread) or until the given deadline passes.
+	// Woken up action is ticked again in the same ECF tick. When the deadline passes, DeadlineReached is called first.
+	// The deadline is measured in the time of this action (respecting pause and time dilation settings).
+	// Pausing the action freezes the time left to its deadline. Use 0 or less for no deadline.
+	// Parking already parked action only changes its deadline.
+	void Park(float InDeadlineTime = 0.f);
+
+	// Returns the thread safe object which wakes up this action when it is parked.
+	// Must be called from the Game Thread.
+	FECFAsyncCompletion GetAsyncCompletion();
+
+	// Function called when the deadline of this parked action has passed.
+	virtual void DeadlineReached() {}
+
+	// Waits until the time of this action reaches the given wait time, starting from the given current time.
+	// The action is parked with an absolute deadline in the time of its clock, so it is not ticked at all 
+	// and DeadlineReached is called when the time has passed. The first delay from settings is waited for too.
+	// If there is no time left the action is not parked (or is woken up) and will be ticked as usual.
+	void WaitForActionTime(float InWaitTime, float InCurrentTime = 0.f);
+
+	// Returns the time of the action waiting with WaitForActionTime, derived from its deadline.
+	float GetWaitedActionTime() const;
+
+	// Returns the time left to the deadline of this parked action. 0 if the action is not parked or has no deadline.
+	double GetParkTimeLeft() const;
+
+	// Starts the async work of this action. If the action has an async lane set in its settings,
+	// the work is submitted to that lane and can wait in its backlog. Otherwise it is started right away.
+	// Must be called from the Game Thread.
+	void LaunchAsyncTask(ENamedThreads::Type ThreadType, TUniqueFunction<void()>&& Work);
+
 	// For any action that should last only the given time - set this function
 	// inside the action's Setup step. 
 	// WARNING! This is only to help ticker run ticks with proper delta times.
@@ -141,8 +220,12 @@ protected:
 	// InstanceId for actions that are instanced
 	FECFInstanceId InstanceId;
 
-	// Settings for this action
-	FECFActionSettings Settings;
+	// Settings for this action. Points to the shared copy of default or interned settings, or to OwnSettings.
+	const FECFActionSettings* Settings = nullptr;
+
+	// Copy of settings which are not shared with other actions. Allocated only for such settings,
+	// so actions launched with shared settings carry just the pointer.
+	TUniquePtr<FECFActionSettings> OwnSettings;
 
 	// Sets the owner and handle id of this action.
 	void SetAction(const UObject* InOwner, const FECFHandle& InHandleId, const FECFInstanceId& InInstanceId, const FECFActionSettings& InSettings)
@@ -150,16 +233,27 @@ protected:
 		Owner = InOwner;
 		HandleId = InHandleId;
 		InstanceId = InInstanceId;
-		Settings = InSettings;
 
-		CurrentActionTime = 0.f;
-		AccumulatedTime = 0.f;
+		// Don't copy settings which are shared anyway.
+		Settings = FECFActionSettingsRegistry::FindShared(InSettings);
+		if (Settings == nullptr)
+		{
+			OwnSettings = MakeUnique<FECFActionSettings>(InSettings);
+			Settings = OwnSettings.Get();
+		}
+		else
+		{
+			OwnSettings.Reset();
+		}
 
-		ActionDelayLeft = Settings.FirstDelay;
+		CurrentActionTime = 0.0;
+		AccumulatedTime = 0.0;
+
+		ActionDelayLeft = Settings->FirstDelay;
 
 		bFirstTick = true;
 
-		if (Settings.bStartPaused)
+		if (Settings->bStartPaused)
 		{
 			bIsPaused = true;
 		}
@@ -169,7 +263,16 @@ protected:
 	virtual float GetActionTime() const
 	{
 #if ECF_LOGS
-		UE_LOG(LogECF, Error, TEXT("ECF - [%s] GetActionTime - this action does not support time tracking."), *Settings.Label);
+		UE_LOG(LogECF, Error, TEXT("ECF - [%s] GetActionTime - this action does not support time tracking."), *Settings->Label);
+#endif
+		return -1.f;
+	}
+
+	// Gets the progress of the action in range [0, 1]. Returns -1 if the action doesn't support progress tracking.
+	virtual float GetActionProgress() const
+	{
+#if ECF_LOGS
+		UE_LOG(LogECF, Error, TEXT("ECF - [%s] GetActionProgress - this action does not support progress tracking."), *Settings->Label);
 #endif
 		return -1.f;
 	}
@@ -178,7 +281,7 @@ protected:
 	virtual bool SetActionTime(float NewTime, bool bCallUpdate)
 	{
 #if ECF_LOGS
-		UE_LOG(LogECF, Error, TEXT("ECF - [%s] SetActionTime - this action does not support time tracking."), *Settings.Label);
+		UE_LOG(LogECF, Error, TEXT("ECF - [%s] SetActionTime - this action does not support time tracking."), *Settings->Label);
 #endif
 		return false;
 	}
@@ -194,32 +297,7 @@ private:
 			return;
 		}
 
-		// If game is paused and the action does not ignore this pause - ignore tick.
-		if (Settings.bIgnorePause == false)
-		{
-			if (UWorld* World = GetWorld())
-			{
-				if (World->IsPaused())
-				{
-					return;
-				}
-			}
-		}
-
-		// If global time dilation is not ignored (by default it is not) apply
-		// this time dilation to the delta time.
-		if (Settings.bIgnoreGlobalTimeDilation == false)
-		{
-			float TimeDilation = 1.f;
-			if (UWorld* World = GetWorld())
-			{
-				if (AWorldSettings* WorldSettings = World->GetWorldSettings())
-				{
-					TimeDilation = WorldSettings->TimeDilation;
-				}
-			}
-			DeltaTime *= TimeDilation;
-		}
+		// The game pause and the time dilation have been already applied to the delta time by the clock of this action.
 
 		// Delay first tick if specified in settings.
 		if (ActionDelayLeft > 0.f)
@@ -238,11 +316,11 @@ private:
 			// If not, simply do a tick.
 			// WARNING! This will not stop the action. Ensure that the action has proper logic in tick function
 			// that will stop it when the time has passed.
-			if (Settings.TickInterval > 0.f)
+			if (Settings->TickInterval > 0.f)
 			{
 				AccumulatedTime += DeltaTime;
-				Tick(AccumulatedTime);
-				AccumulatedTime = 0;
+				Tick(static_cast<float>(AccumulatedTime));
+				AccumulatedTime = 0.0;
 			}
 			else
 			{
@@ -261,15 +339,12 @@ private:
 			{
 				// If we have specified tick intervals accumulate time until it won't reach the desired interval.
 				// Tick with the given interval, otherwise do a simple tick.
-				// Clear accumulated time (no subtract the interval) as we are interested in ticks 
-				// that happens the exact time after the previous one.
-				if (Settings.TickInterval > 0.f)
+				if (Settings->TickInterval > 0.f)
 				{
 					AccumulatedTime += DeltaTime;
-					if (AccumulatedTime >= Settings.TickInterval)
+					if (AccumulatedTime >= Settings->TickInterval)
 					{
-						Tick(Settings.TickInterval);
-						AccumulatedTime = 0;
+						DoIntervalTicks();
 					}
 				}
 				else
@@ -280,20 +355,124 @@ private:
 		}
 	}
 
+	// Performs ticks for intervals which have passed, according to the Interval Catch Up setting.
+	// The time left over from the intervals stays accumulated, so the ticks don't drift.
+	void DoIntervalTicks()
+	{
+		const double TickInterval = Settings->TickInterval;
+		const double IntervalsNum = FMath::FloorToDouble(AccumulatedTime / TickInterval);
+		switch (Settings->IntervalCatchUp)
+		{
+			case EECFIntervalCatchUp::Skip:
+				AccumulatedTime -= IntervalsNum * TickInterval;
+				Tick(Settings->TickInterval);
+				break;
+			case EECFIntervalCatchUp::FireOnce:
+				AccumulatedTime -= IntervalsNum * TickInterval;
+				Tick(static_cast<float>(IntervalsNum * TickInterval));
+				break;
+			case EECFIntervalCatchUp::FireAll:
+				// Stop catching up when the action has been finished or paused by one of the ticks.
+				while (AccumulatedTime >= TickInterval && bHasFinished == false && bIsPaused == false)
+				{
+					AccumulatedTime -= TickInterval;
+					Tick(Settings->TickInterval);
+				}
+				break;
+		}
+	}
+
+	// Performs a tick, adding the time accumulated while the tick was deferred by the ECF tick budget.
+	void DoDeferrableTick(float DeltaTime)
+	{
+		const float TickDeltaTime = DeltaTime + DeferredDeltaTime;
+		DeferredDeltaTime = 0.f;
+		bIsTickDeferred = false;
+		DoTick(TickDeltaTime);
+	}
+
+	// Skips this tick, accumulating its delta time for the next one.
+	void DeferTick(float DeltaTime)
+	{
+		DeferredDeltaTime += DeltaTime;
+		bIsTickDeferred = true;
+	}
+
+	// Skips this tick because of the tick LOD, accumulating its delta time for the next one.
+	void SkipLODTick(float DeltaTime)
+	{
+		DeferredDeltaTime += DeltaTime;
+	}
+
+	// Checks if the action should tick in the given frame according to its tick LOD level.
+	bool ShouldTickLOD(uint64 FrameCounter) const
+	{
+		return ((FrameCounter + TickLODPhase) & ((1ull << TickLODLevel) - 1)) == 0;
+	}
+
 	// Indicates if this action has finished and will be deleted soon.
 	bool bHasFinished = false;
 
 	// Indicates if this is a first tick. First tick should be launched as
 	// soon as possible, without consideration of tick interval.
+	// Actions with spread tick phase skip it and start with accumulated time instead.
 	bool bFirstTick = false;
 
 	// Indicates if this action is paused (by the ECF system).
 	bool bIsPaused = false;
 
-	// Timers for this action
-	float CurrentActionTime = 0.f;
+	// Indicates if the subsystem tracks the lifetime of this action's owner.
+	bool bOwnerLifetimeTracked = false;
+
+	// Indicates if this action is parked and should not be ticked.
+	bool bIsParked = false;
+
+	// Index in the subsystem's parked actions list. INDEX_NONE if the action hasn't been moved there (yet).
+	int32 ParkedIndex = INDEX_NONE;
+
+	// Serial number of the current deadline. Changed every time the deadline is changed or cancelled,
+	// so outdated deadlines left in the scheduler can be recognized and ignored.
+	uint32 DeadlineSerial = 0;
+
+	// Index of the subsystem's clock driving the time of this action.
+	int32 ClockIndex = 0;
+
+	// Absolute time of the deadline of this parked action, in the time of its clock.
+	double ParkDeadline = 0.0;
+
+	// Time left to the deadline of this parked action. Used while the action is paused. 0 means there is no deadline.
+	float ParkTimeLeft = 0.f;
+
+	// The time of the action at which waiting started with WaitForActionTime ends.
+	float WaitEndTime = 0.f;
+
+	// Indicates if the last tick of this action has been deferred by the ECF tick budget.
+	// Deferred actions are never deferred twice in a row, so they can't starve.
+	bool bIsTickDeferred = false;
+
+	// Delta time accumulated while ticks of this action were deferred.
+	float DeferredDeltaTime = 0.f;
+
+	// Indicates if this action is being ticked on a worker thread in the parallel tick phase.
+	bool bIsTickingInParallel = false;
+
+	// Indicates if this action only computes its tick on a worker thread and if the computed state waits to be applied.
+	bool bIsComputingTick = false;
+	bool bHasTickToApply = false;
+
+	// Indicates if this action has finished in the parallel tick phase and waits for the completion on the Game Thread.
+	bool bIsCompletionDeferred = false;
+
+	// Tick LOD level of this action. The action ticks every 2^TickLODLevel frames.
+	uint8 TickLODLevel = 0;
+
+	// Offset of frames in which the action with lowered tick rate ticks, so such actions don't tick in the same frame.
+	uint8 TickLODPhase = 0;
+
+	// Timers for this action. Accumulated in double precision, so long running actions don't lose time.
+	double CurrentActionTime = 0.0;
 	float ActionDelayLeft = 0.f;
-	float AccumulatedTime = 0.f;
+	double AccumulatedTime = 0.0;
 	float MaxActionTime = 0.f;
 };
 
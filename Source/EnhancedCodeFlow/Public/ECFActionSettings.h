@@ -3,6 +3,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "ECFTypes.h"
 #include "ECFActionSettings.generated.h"
 
 USTRUCT(BlueprintType)
@@ -11,26 +12,94 @@ struct ENHANCEDCODEFLOW_API FECFActionSettings
 	GENERATED_BODY()
 
 	FECFActionSettings() :
-		TickInterval(0.f),
-		FirstDelay(0.f),
 		bIgnorePause(false),
 		bIgnoreGlobalTimeDilation(false),
 		bStartPaused(false),
+		bTrackOwnerLifetime(false),
+		bImmediateContinuation(false),
+		bSerializeAsyncPerOwner(false),
+		bSpreadTickPhase(false),
+		bActivateImmediately(false),
+		bUseTickLOD(false),
+		bThreadSafeTick(false),
+		bParallelCompute(false),
+		TickInterval(0.f),
+		FirstDelay(0.f),
 		Label(TEXT(""))
 	{
 
 	}
 
 	FECFActionSettings(float InTickInterval, float InFirstDelay = 0.f, bool InIgnorePause = false, bool InIgnoreTimeDilation = false, bool InStartPaused = false, const FString& InLabel = TEXT("")) :
-		TickInterval(InTickInterval),
-		FirstDelay(InFirstDelay),
 		bIgnorePause(InIgnorePause),
 		bIgnoreGlobalTimeDilation(InIgnoreTimeDilation),
 		bStartPaused(InStartPaused),
+		bTrackOwnerLifetime(false),
+		bImmediateContinuation(false),
+		bSerializeAsyncPerOwner(false),
+		bSpreadTickPhase(false),
+		bActivateImmediately(false),
+		bUseTickLOD(false),
+		bThreadSafeTick(false),
+		bParallelCompute(false),
+		TickInterval(InTickInterval),
+		FirstDelay(InFirstDelay),
 		Label(InLabel)
 	{
 	}
 
+	// Flags are packed into bitfields to keep the settings small. They are initialized by the constructors.
+
+	UPROPERTY(BlueprintReadWrite, Category = "ECF")
+	uint8 bIgnorePause : 1;
+
+	UPROPERTY(BlueprintReadWrite, Category = "ECF")
+	uint8 bIgnoreGlobalTimeDilation : 1;
+
+	UPROPERTY(BlueprintReadWrite, Category = "ECF")
+	uint8 bStartPaused : 1;
+
+	// If true, the owner of the action is not validated every tick. Instead, all actions of the owner are
+	// invalidated at once when the owner is destroyed (Actor's OnDestroyed/OnEndPlay) or garbage collected.
+	UPROPERTY(BlueprintReadWrite, Category = "ECF")
+	uint8 bTrackOwnerLifetime : 1;
+
+	// If true, actions waiting for async work (like Run Async Then) continue as soon as the Game Thread
+	// is notified that the work is done, possibly in the same frame, instead of at the beginning of the next ECF tick.
+	UPROPERTY(BlueprintReadWrite, Category = "ECF")
+	uint8 bImmediateContinuation : 1;
+
+	// If true, async work of this action (like Run Async Then) runs after async work of all previous actions
+	// of the same owner and Async Pipe with this setting has finished. Async work of different owners or pipes runs concurrently.
+	UPROPERTY(BlueprintReadWrite, Category = "ECF")
+	uint8 bSerializeAsyncPerOwner : 1;
+
+	// If true, the first tick of the action with Tick Interval is shifted, so ticks of many actions with the same interval
+	// are spread evenly across the interval instead of landing on the same frame. The interval itself is preserved.
+	UPROPERTY(BlueprintReadWrite, Category = "ECF")
+	uint8 bSpreadTickPhase : 1;
+
+	// If true, the action created while other actions of its tick group are being ticked (e.g. from their callbacks)
+	// starts ticking in the same tick, instead of the next one. Useful for chains of actions, which otherwise lose a frame per hop.
+	UPROPERTY(BlueprintReadWrite, Category = "ECF")
+	uint8 bActivateImmediately : 1;
+
+	// If true, the action ticks less often when its owner is less significant (e.g. far from the camera),
+	// according to the tick LOD policy set with FFlow::SetTickLODPolicy. Skipped ticks are added to the next tick's delta time.
+	UPROPERTY(BlueprintReadWrite, Category = "ECF")
+	uint8 bUseTickLOD : 1;
+
+	// Ticks the action on worker threads in parallel with other thread safe actions, partitioned by owner.
+	// Only Ticker and Timelines (except custom ones) support it. The tick function must only touch data of its owner.
+	// Completion callbacks are run on the Game Thread.
+	UPROPERTY(BlueprintReadWrite, Category = "ECF")
+	uint8 bThreadSafeTick : 1;
+
+	// Computes the new state of the action (like the value of a timeline) on worker threads in parallel with other actions.
+	// The tick function is then called on the Game Thread with the computed state. Only Timelines (except custom ones) support it.
+	UPROPERTY(BlueprintReadWrite, Category = "ECF")
+	uint8 bParallelCompute : 1;
+
 	UPROPERTY(BlueprintReadWrite, Category = "ECF")
 	float TickInterval = 0.f;
 
@@ -49,33 +118,151 @@ struct ENHANCEDCODEFLOW_API FECFActionSettings
 		return *this;
 	}
 
-	UPROPERTY(BlueprintReadWrite, Category = "ECF")
-	bool bIgnorePause = false;
-
 	FECFActionSettings& WithIgnorePause()
 	{
 		bIgnorePause = true;
 		return *this;
 	}
 
-	UPROPERTY(BlueprintReadWrite, Category = "ECF")
-	bool bIgnoreGlobalTimeDilation = false;
-
 	FECFActionSettings& WithIgnoreGlobalTimeDilation()
 	{
 		bIgnoreGlobalTimeDilation = true;
 		return *this;
 	}
 
-	UPROPERTY(BlueprintReadWrite, Category = "ECF")
-	bool bStartPaused = false;
-
 	FECFActionSettings& WithStartPaused()
 	{
 		bStartPaused = true;
 		return *this;
 	}
 
+	FECFActionSettings& WithOwnerLifetimeTracking()
+	{
+		bTrackOwnerLifetime = true;
+		return *this;
+	}
+
+	FECFActionSettings& WithImmediateContinuation()
+	{
+		bImmediateContinuation = true;
+		return *this;
+	}
+
+	// Name of the async lane in which async work of the action (like Run Async Then) is run.
+	// Lanes limit the number of async tasks running at once. Excess tasks wait in the lane's backlog.
+	// If None, async work is started right away.
+	UPROPERTY(BlueprintReadWrite, Category = "ECF")
+	FName AsyncLane = NAME_None;
+
+	// Priority of the async work in the lane's backlog. Higher priorities are started first,
+	// tasks with the same priority are started in the order they were submitted.
+	UPROPERTY(BlueprintReadWrite, Category = "ECF")
+	int32 AsyncPriority = 0;
+
+	FECFActionSettings& WithAsyncLane(FName InAsyncLane, int32 InAsyncPriority = 0)
+	{
+		AsyncLane = InAsyncLane;
+		AsyncPriority = InAsyncPriority;
+		return *this;
+	}
+
+	// Name of the pipe of the owner in which async work is serialized. Lets one owner have many independent pipes
+	// (e.g. one for saving and one for loading). None is the default pipe of the owner.
+	UPROPERTY(BlueprintReadWrite, Category = "ECF")
+	FName AsyncPipe = NAME_None;
+
+	FECFActionSettings& WithAsyncSerializedPerOwner(FName InAsyncPipe = NAME_None)
+	{
+		bSerializeAsyncPerOwner = true;
+		AsyncPipe = InAsyncPipe;
+		return *this;
+	}
+
+	// Priority tier of the action used when the ECF tick budget is set (see FFlow::SetTickBudget).
+	// Actions that don't fit into the budget are deferred to the next tick and receive the accumulated delta time.
+	UPROPERTY(BlueprintReadWrite, Category = "ECF")
+	EECFTickPriority TickPriority = EECFTickPriority::Normal;
+
+	FECFActionSettings& WithTickPriority(EECFTickPriority InTickPriority)
+	{
+		TickPriority = InTickPriority;
+		return *this;
+	}
+
+	FECFActionSettings& WithTickPhaseSpreading()
+	{
+		bSpreadTickPhase = true;
+		return *this;
+	}
+
+	// The point of the frame in which the action is ticked. Use it to tick actions driving transforms
+	// before or after physics or cameras, without one frame latency.
+	UPROPERTY(BlueprintReadWrite, Category = "ECF")
+	EECFTickGroup TickGroup = EECFTickGroup::Default;
+
+	FECFActionSettings& WithTickGroup(EECFTickGroup InTickGroup)
+	{
+		TickGroup = InTickGroup;
+		return *this;
+	}
+
+	FECFActionSettings& WithImmediateActivation()
+	{
+		bActivateImmediately = true;
+		return *this;
+	}
+
+	// Defines how the action with Tick Interval handles ticks missed during long frames.
+	// The time left over from every interval is kept, so interval ticks don't drift regardless of this setting.
+	UPROPERTY(BlueprintReadWrite, Category = "ECF")
+	EECFIntervalCatchUp IntervalCatchUp = EECFIntervalCatchUp::Skip;
+
+	FECFActionSettings& WithIntervalCatchUp(EECFIntervalCatchUp InIntervalCatchUp)
+	{
+		IntervalCatchUp = InIntervalCatchUp;
+		return *this;
+	}
+
+	// Name of the custom clock registered with FFlow::RegisterClock, which drives the time of the action.
+	// Actions with a custom clock ignore Ignore Pause and Ignore Global Time Dilation settings, the clock decides about them.
+	// None uses the game time.
+	UPROPERTY(BlueprintReadWrite, Category = "ECF")
+	FName Clock = NAME_None;
+
+	FECFActionSettings& WithClock(FName InClock)
+	{
+		Clock = InClock;
+		return *this;
+	}
+
+	// Name of the action group. Actions of the same group can be paused, resumed and dilated at once.
+	UPROPERTY(BlueprintReadWrite, Category = "ECF")
+	FName ActionGroup = NAME_None;
+
+	FECFActionSettings& WithActionGroup(FName InActionGroup)
+	{
+		ActionGroup = InActionGroup;
+		return *this;
+	}
+
+	FECFActionSettings& WithTickLOD()
+	{
+		bUseTickLOD = true;
+		return *this;
+	}
+
+	FECFActionSettings& WithThreadSafeTick()
+	{
+		bThreadSafeTick = true;
+		return *this;
+	}
+
+	FECFActionSettings& WithParallelCompute()
+	{
+		bParallelCompute = true;
+		return *this;
+	}
+
 	UPROPERTY(BlueprintReadWrite, Category = "ECF")
 	FString Label;
 
@@ -84,12 +271,86 @@ struct ENHANCEDCODEFLOW_API FECFActionSettings
 		Label = InLabel;
 		return *this;
 	}
+
+	// Compares all settings. New settings must be added here, otherwise actions could share wrong settings.
+	bool operator==(const FECFActionSettings& Other) const
+	{
+		return	TickInterval == Other.TickInterval &&
+				FirstDelay == Other.FirstDelay &&
+				bIgnorePause == Other.bIgnorePause &&
+				bIgnoreGlobalTimeDilation == Other.bIgnoreGlobalTimeDilation &&
+				bStartPaused == Other.bStartPaused &&
+				bTrackOwnerLifetime == Other.bTrackOwnerLifetime &&
+				bImmediateContinuation == Other.bImmediateContinuation &&
+				AsyncLane == Other.AsyncLane &&
+				AsyncPriority == Other.AsyncPriority &&
+				bSerializeAsyncPerOwner == Other.bSerializeAsyncPerOwner &&
+				AsyncPipe == Other.AsyncPipe &&
+				TickPriority == Other.TickPriority &&
+				bSpreadTickPhase == Other.bSpreadTickPhase &&
+				TickGroup == Other.TickGroup &&
+				bActivateImmediately == Other.bActivateImmediately &&
+				IntervalCatchUp == Other.IntervalCatchUp &&
+				Clock == Other.Clock &&
+				ActionGroup == Other.ActionGroup &&
+				bUseTickLOD == Other.bUseTickLOD &&
+				bThreadSafeTick == Other.bThreadSafeTick &&
+				bParallelCompute == Other.bParallelCompute &&
+				Label.Equals(Other.Label, ESearchCase::CaseSensitive);
+	}
+
+	bool operator!=(const FECFActionSettings& Other) const
+	{
+		return (*this == Other) == false;
+	}
+
+	// Returns the immutable copy of these settings shared by all actions launched with them, and caches it inside this object.
+	// Call it once on settings objects that are reused many times (like static presets), so actions launched with them
+	// don't copy the settings. Shared copies are never released, so don't intern settings with computed values or Labels.
+	const FECFActionSettings* Intern() const;
+
+	// Commonly used settings presets. They are interned once and shared by every action using them.
+	static const FECFActionSettings& DefaultPreset();
+	static const FECFActionSettings& IgnorePausePreset();
+	static const FECFActionSettings& IgnoreTimeDilationPreset();
+	static const FECFActionSettings& IgnorePauseDilationPreset();
+	static const FECFActionSettings& StartPausedPreset();
+
+private:
+
+	friend class FECFActionSettingsRegistry;
+
+	// Cached shared copy of these settings. It is always validated before use,
+	// because Blueprints and users can modify the properties directly.
+	mutable const FECFActionSettings* CachedInterned = nullptr;
+};
+
+/**
+ * Thread safe storage of action settings shared between actions.
+ * Only the default settings and explicitly interned settings (like presets) are shared.
+ * Actions launched with any other settings keep their own copy, so computed values don't grow the storage.
+ */
+class ENHANCEDCODEFLOW_API FECFActionSettingsRegistry
+{
+public:
+
+	// Returns the shared copy of the given settings if they are the default or explicitly interned ones. Otherwise returns nullptr.
+	static const FECFActionSettings* FindShared(const FECFActionSettings& InSettings);
+
+	// Returns the shared copy of the given settings. Creates it if it doesn't exist yet.
+	static const FECFActionSettings* Intern(const FECFActionSettings& InSettings);
+
+	// Returns the shared copy of the default settings.
+	static const FECFActionSettings* GetDefault();
+
+	// Returns the number of unique settings interned so far. Use it mostly for debugging purposes.
+	static int32 Num();
 };
 
 #define ECF_TICKINTERVAL(_Interval) FECFActionSettings().WithTickInterval(_Interval)
 #define ECF_DELAYFIRST(_Delay) FECFActionSettings().WithFirstDelay(_Delay)
-#define ECF_IGNOREPAUSE FECFActionSettings().WithIgnorePause()
-#define ECF_IGNORETIMEDILATION FECFActionSettings().WithIgnoreGlobalTimeDilation()
-#define ECF_IGNOREPAUSEDILATION ECFActionSettings().WithIgnorePause().WithIgnoreGlobalTimeDilation()
-#define ECF_STARTPAUSED ECFActionSettings().WithStartPaused()
-#define ECF_LABEL(_Label) ECFActionSettings().WithLabel(_Label)
+#define ECF_IGNOREPAUSE FECFActionSettings(FECFActionSettings::IgnorePausePreset())
+#define ECF_IGNORETIMEDILATION FECFActionSettings(FECFActionSettings::IgnoreTimeDilationPreset())
+#define ECF_IGNOREPAUSEDILATION FECFActionSettings(FECFActionSettings::IgnorePauseDilationPreset())
+#define ECF_STARTPAUSED FECFActionSettings(FECFActionSettings::StartPausedPreset())
+#define ECF_LABEL(_Label) FECFActionSettings().WithLabel(_Label)
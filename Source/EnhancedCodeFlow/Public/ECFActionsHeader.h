@@ -7,6 +7,7 @@
 #include "CodeFlowActions/ECFDelayTicks.h"
 #include "CodeFlowActions/ECFWaitAndExecute.h"
 #include "CodeFlowActions/ECFWhileTrueExecute.h"
+#include "CodeFlowActions/ECFForEachTimeSliced.h"
 #include "CodeFlowActions/ECFTimeline.h"
 #include "CodeFlowActions/ECFTimelineVector.h"
 #include "CodeFlowActions/ECFTimelineLinearColor.h"
@@ -18,4 +19,6 @@
 #include "CodeFlowActions/ECFDoNTimes.h"
 #include "CodeFlowActions/ECFDoNoMoreThanXTime.h"
 #include "CodeFlowActions/ECFRunAsyncThen.h"
+#include "CodeFlowActions/ECFParallelForThen.h"
+#include "CodeFlowActions/ECFRunPipeline.h"
 #include "CodeFlowActions/ECFLoadObjectsAsync.h"
\ No newline at end of file
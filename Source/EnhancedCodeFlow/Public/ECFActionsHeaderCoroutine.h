@@ -6,6 +6,7 @@
 #include "CodeFlowActions/Coroutines/ECFWaitTicks.h"
 #include "CodeFlowActions/Coroutines/ECFWaitUntil.h"
 #include "CodeFlowActions/Coroutines/ECFWaitForFlag.h"
+#include "CodeFlowActions/Coroutines/ECFWaitForSignal.h"
 #include "CodeFlowActions/Coroutines/ECFRunAsyncAndWait.h"
 #include "CodeFlowActions/Coroutines/ECFWaitLoadObjects.h"
 #include "CodeFlowActions/Coroutines/ECFLoopAndWait.h"
\ No newline at end of file
@@ -0,0 +1,45 @@
+// Copyright (c) 2026 Damian Nowakowski. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Queue.h"
+#include "Templates/SharedPointer.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+ECF_PRAGMA_DISABLE_OPTIMIZATION
+
+class UECFActionBase;
+class UECFSubsystem;
+
+// Queue of parked actions which async work has been done. Filled from any thread, drained on the Game Thread.
+using FECFCompletionQueue = TQueue<TWeakObjectPtr<UECFActionBase>, EQueueMode::Mpsc>;
+
+/**
+ * Thread safe object used to wake up a parked action when its async work is done.
+ * Obtain it on the Game Thread with UECFActionBase::GetAsyncCompletion and pass it to the async work.
+ */
+class ENHANCEDCODEFLOW_API FECFAsyncCompletion
+{
+	friend class UECFActionBase;
+
+public:
+
+	// Wakes up the action. Can be called from any thread.
+	void Signal() const;
+
+	// Checks if this completion has been obtained from a valid action.
+	bool IsValid() const
+	{
+		return CompletionQueue.IsValid();
+	}
+
+private:
+
+	TWeakObjectPtr<UECFActionBase> Action;
+	TWeakObjectPtr<UECFSubsystem> Subsystem;
+	TSharedPtr<FECFCompletionQueue, ESPMode::ThreadSafe> CompletionQueue;
+	bool bImmediateContinuation = false;
+};
+
+ECF_PRAGMA_ENABLE_OPTIMIZATION
\ No newline at end of file
@@ -0,0 +1,170 @@
+// Copyright (c) 2026 Damian Nowakowski. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/Optional.h"
+#include "Templates/SharedPointer.h"
+#include "Templates/Atomic.h"
+#include "ECFCancellationToken.h"
+
+ECF_PRAGMA_DISABLE_OPTIMIZATION
+
+/**
+ * Async work run by Run Async Then and Run Async And Wait actions.
+ * Keeps the task, its result and the callback together in one object shared by the action and the worker thread,
+ * so the worker never touches the action, which can be destroyed while the task is still running.
+ */
+class FECFAsyncJobBase
+{
+
+public:
+
+	virtual ~FECFAsyncJobBase() {}
+
+	// Runs the task and marks the job as done. Called on the worker thread.
+	void Execute(const FECFCancellationToken& CancellationToken)
+	{
+		Run(CancellationToken);
+		bIsDone = true;
+	}
+
+	// Checks if the task has finished and its result can be read on the Game Thread.
+	bool IsDone() const
+	{
+		return bIsDone;
+	}
+
+	// Calls the callback. Called on the Game Thread. bHasResult must be true only if the job is done.
+	virtual void Finish(bool bHasResult, bool bTimedOut, bool bStopped) = 0;
+
+protected:
+
+	// Runs the task and stores its result.
+	virtual void Run(const FECFCancellationToken& CancellationToken) = 0;
+
+private:
+
+	TAtomic<bool> bIsDone = false;
+};
+
+using FECFAsyncJobPtr = TSharedPtr<FECFAsyncJobBase, ESPMode::ThreadSafe>;
+
+namespace ECFAsyncJob
+{
+	// Tasks can optionally take the cancellation token.
+	template<typename TTask>
+	auto InvokeTask(TTask& Task, const FECFCancellationToken& CancellationToken) -> decltype(Task(CancellationToken))
+	{
+		return Task(CancellationToken);
+	}
+
+	template<typename TTask>
+	auto InvokeTask(TTask& Task, const FECFCancellationToken& CancellationToken) -> decltype(Task())
+	{
+		return Task();
+	}
+
+	// Callbacks can optionally take the bTimedOut and bStopped flags after the result.
+	template<typename TCallback, typename ... TArgs>
+	auto InvokeCallback(TCallback& Callback, bool bTimedOut, bool bStopped, TArgs&& ... Args) -> decltype(Callback(Forward<TArgs>(Args)..., bTimedOut, bStopped))
+	{
+		return Callback(Forward<TArgs>(Args)..., bTimedOut, bStopped);
+	}
+
+	template<typename TCallback, typename ... TArgs>
+	auto InvokeCallback(TCallback& Callback, bool bTimedOut, bool bStopped, TArgs&& ... Args) -> decltype(Callback(Forward<TArgs>(Args)..., bTimedOut))
+	{
+		return Callback(Forward<TArgs>(Args)..., bTimedOut);
+	}
+
+	template<typename TCallback, typename ... TArgs>
+	auto InvokeCallback(TCallback& Callback, bool bTimedOut, bool bStopped, TArgs&& ... Args) -> decltype(Callback(Forward<TArgs>(Args)...))
+	{
+		return Callback(Forward<TArgs>(Args)...);
+	}
+}
+
+/**
+ * Async job returning a value. The result is stored inside the job and moved to the callback,
+ * which receives it as TOptional<TResult>&&. The optional is empty if the task hasn't finished
+ * (e.g. the action timed out or has been stopped).
+ */
+template<typename TResult, typename TTask, typename TCallback>
+class TECFAsyncJob : public FECFAsyncJobBase
+{
+
+public:
+
+	template<typename TInTask, typename TInCallback>
+	TECFAsyncJob(TInTask&& InTask, TInCallback&& InCallback) :
+		Task(Forward<TInTask>(InTask)),
+		Callback(Forward<TInCallback>(InCallback))
+	{
+	}
+
+	void Finish(bool bHasResult, bool bTimedOut, bool bStopped) override
+	{
+		// Don't touch the result if the task can still be running on the worker thread.
+		TOptional<TResult> FinishedResult;
+		if (bHasResult)
+		{
+			FinishedResult = MoveTemp(Result);
+		}
+		ECFAsyncJob::InvokeCallback(Callback, bTimedOut, bStopped, MoveTemp(FinishedResult));
+	}
+
+protected:
+
+	void Run(const FECFCancellationToken& CancellationToken) override
+	{
+		Result.Emplace(ECFAsyncJob::InvokeTask(Task, CancellationToken));
+	}
+
+private:
+
+	TTask Task;
+	TCallback Callback;
+	TOptional<TResult> Result;
+};
+
+// Async job without a result.
+template<typename TTask, typename TCallback>
+class TECFAsyncJob<void, TTask, TCallback> : public FECFAsyncJobBase
+{
+
+public:
+
+	template<typename TInTask, typename TInCallback>
+	TECFAsyncJob(TInTask&& InTask, TInCallback&& InCallback) :
+		Task(Forward<TInTask>(InTask)),
+		Callback(Forward<TInCallback>(InCallback))
+	{
+	}
+
+	void Finish(bool bHasResult, bool bTimedOut, bool bStopped) override
+	{
+		ECFAsyncJob::InvokeCallback(Callback, bTimedOut, bStopped);
+	}
+
+protected:
+
+	void Run(const FECFCancellationToken& CancellationToken) override
+	{
+		ECFAsyncJob::InvokeTask(Task, CancellationToken);
+	}
+
+private:
+
+	TTask Task;
+	TCallback Callback;
+};
+
+// Creates the async job. The task and the callback are stored by value, so lambdas don't need any extra allocation.
+template<typename TResult, typename TTask, typename TCallback>
+FECFAsyncJobPtr MakeECFAsyncJob(TTask&& InTask, TCallback&& InCallback)
+{
+	return MakeShared<TECFAsyncJob<TResult, typename TDecay<TTask>::Type, typename TDecay<TCallback>::Type>, ESPMode::ThreadSafe>(Forward<TTask>(InTask), Forward<TCallback>(InCallback));
+}
+
+ECF_PRAGMA_ENABLE_OPTIMIZATION
\ No newline at end of file
@@ -0,0 +1,100 @@
+// Copyright (c) 2026 Damian Nowakowski. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "Templates/SharedPointer.h"
+#include "Async/TaskGraphInterfaces.h"
+
+ECF_PRAGMA_DISABLE_OPTIMIZATION
+
+// Snapshot of the async lane statistics. Times are in seconds.
+struct FECFAsyncLaneStats
+{
+	// Maximum number of tasks running at once.
+	int32 MaxInFlight = 0;
+
+	// Number of tasks running right now.
+	int32 InFlight = 0;
+
+	// Number of tasks waiting in the backlog.
+	int32 QueueDepth = 0;
+
+	// Number of tasks finished so far.
+	int64 CompletedTasks = 0;
+
+	// Average and maximum time tasks have been waiting in the backlog.
+	double AverageWaitTime = 0.0;
+	double MaxWaitTime = 0.0;
+
+	// Average and maximum time tasks have been running.
+	double AverageRunTime = 0.0;
+	double MaxRunTime = 0.0;
+};
+
+/**
+ * Limits the number of async tasks running at once, so bursts of tasks don't flood the background threads.
+ * Excess tasks wait in the backlog ordered by priority (then by the submission order).
+ * When a task finishes, the next one from the backlog is started directly from the worker thread.
+ * All functions are thread safe.
+ */
+class ENHANCEDCODEFLOW_API FECFAsyncLane : public TSharedFromThis<FECFAsyncLane, ESPMode::ThreadSafe>
+{
+
+public:
+
+	FECFAsyncLane(int32 InMaxInFlight) :
+		MaxInFlight(FMath::Max(InMaxInFlight, 1))
+	{
+	}
+
+	// Starts the task if there is a free slot in the lane, otherwise puts it to the backlog.
+	void Submit(TUniqueFunction<void()>&& Work, ENamedThreads::Type ThreadType, int32 Priority);
+
+	// Changes the maximum number of tasks running at once. Starts tasks from the backlog if there are new free slots.
+	void SetMaxInFlight(int32 InMaxInFlight);
+
+	// Returns the snapshot of the lane statistics.
+	FECFAsyncLaneStats GetStats() const;
+
+private:
+
+	struct FTask
+	{
+		TUniqueFunction<void()> Work;
+		ENamedThreads::Type ThreadType = ENamedThreads::AnyBackgroundThreadNormalTask;
+		int32 Priority = 0;
+		uint64 Sequence = 0;
+		double QueuedTime = 0.0;
+	};
+
+	// Orders the backlog heap: higher priority first, then the submission order.
+	struct FTaskPredicate
+	{
+		bool operator()(const FTask& A, const FTask& B) const
+		{
+			return A.Priority > B.Priority || (A.Priority == B.Priority && A.Sequence < B.Sequence);
+		}
+	};
+
+	// Starts the task on the worker thread. The task's slot must be already taken.
+	void Dispatch(FTask&& Task);
+
+	// Runs the task and passes its slot to the next task from the backlog.
+	void Run(FTask& Task);
+
+	mutable FCriticalSection CriticalSection;
+	TArray<FTask> Backlog;
+	int32 MaxInFlight = 1;
+	int32 InFlight = 0;
+	uint64 NextSequence = 0;
+
+	int64 CompletedTasks = 0;
+	double TotalWaitTime = 0.0;
+	double MaxWaitTime = 0.0;
+	double TotalRunTime = 0.0;
+	double MaxRunTime = 0.0;
+};
+
+ECF_PRAGMA_ENABLE_OPTIMIZATION
\ No newline at end of file
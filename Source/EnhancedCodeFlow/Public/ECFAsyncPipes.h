@@ -0,0 +1,83 @@
+// Copyright (c) 2026 Damian Nowakowski. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "Templates/SharedPointer.h"
+#include "UObject/ObjectKey.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "ECFAsyncLane.h"
+
+ECF_PRAGMA_DISABLE_OPTIMIZATION
+
+// Identifies the pipe by its owner and the name of the owner's pipe.
+struct FECFAsyncPipeKey
+{
+	FObjectKey Owner;
+	FName Pipe = NAME_None;
+
+	FECFAsyncPipeKey() {}
+	FECFAsyncPipeKey(const UObject* InOwner, FName InPipe) :
+		Owner(InOwner),
+		Pipe(InPipe)
+	{
+	}
+
+	bool operator==(const FECFAsyncPipeKey& Other) const
+	{
+		return Owner == Other.Owner && Pipe == Other.Pipe;
+	}
+
+	friend uint32 GetTypeHash(const FECFAsyncPipeKey& Key)
+	{
+		return HashCombine(GetTypeHash(Key.Owner), GetTypeHash(Key.Pipe));
+	}
+};
+
+/**
+ * Runs async tasks submitted with the same key one after another, while tasks with different keys run concurrently.
+ * When a task finishes, the next task with the same key is started directly from the worker thread,
+ * without returning to the Game Thread in between.
+ * A pipe exists only while it has tasks, so keys can be used freely (e.g. one per owner and pipe name).
+ * All functions are thread safe.
+ */
+class ENHANCEDCODEFLOW_API FECFAsyncPipes : public TSharedFromThis<FECFAsyncPipes, ESPMode::ThreadSafe>
+{
+
+public:
+
+	// Starts the task if there is no other task with the same key, otherwise queues it after them.
+	// If the lane is valid, the task is started in that lane.
+	void Submit(const FECFAsyncPipeKey& Key, TUniqueFunction<void()>&& Work, ENamedThreads::Type ThreadType, TSharedPtr<FECFAsyncLane, ESPMode::ThreadSafe> Lane, int32 Priority);
+
+	// Returns the number of pipes with tasks. Use it mostly for debugging purposes.
+	int32 Num() const;
+
+private:
+
+	struct FTask
+	{
+		TUniqueFunction<void()> Work;
+		ENamedThreads::Type ThreadType = ENamedThreads::AnyBackgroundThreadNormalTask;
+		TSharedPtr<FECFAsyncLane, ESPMode::ThreadSafe> Lane;
+		int32 Priority = 0;
+	};
+
+	// Tasks waiting for the running task of the pipe to finish, in the order they were submitted.
+	struct FPipe
+	{
+		TArray<FTask> Waiting;
+	};
+
+	// Starts the task. It will start the next task of the pipe when it is done.
+	void Start(const FECFAsyncPipeKey& Key, FTask&& Task);
+
+	// Starts the next task of the pipe, or removes the pipe if there are no more tasks.
+	void Continue(const FECFAsyncPipeKey& Key);
+
+	mutable FCriticalSection CriticalSection;
+	TMap<FECFAsyncPipeKey, FPipe> Pipes;
+};
+
+ECF_PRAGMA_ENABLE_OPTIMIZATION
\ No newline at end of file
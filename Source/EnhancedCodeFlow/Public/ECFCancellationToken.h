@@ -0,0 +1,44 @@
+// Copyright (c) 2026 Damian Nowakowski. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/Atomic.h"
+#include "Templates/SharedPointer.h"
+
+ECF_PRAGMA_DISABLE_OPTIMIZATION
+
+/**
+ * Thread safe token used to cooperatively cancel async work started by an action.
+ * The action cancels it when it is stopped, timed out or removed (e.g. because its owner died).
+ * Long running async work should check IsCancelled() from time to time and bail out early.
+ * Copies of the token share the same state.
+ */
+class ENHANCEDCODEFLOW_API FECFCancellationToken
+{
+
+public:
+
+	FECFCancellationToken() :
+		bCancelled(MakeShared<TAtomic<bool>, ESPMode::ThreadSafe>(false))
+	{
+	}
+
+	// Checks if the work should be cancelled. Can be called from any thread.
+	bool IsCancelled() const
+	{
+		return bCancelled->Load(EMemoryOrder::Relaxed);
+	}
+
+	// Cancels the work. Can be called from any thread.
+	void Cancel() const
+	{
+		bCancelled->Store(true, EMemoryOrder::Relaxed);
+	}
+
+private:
+
+	TSharedRef<TAtomic<bool>, ESPMode::ThreadSafe> bCancelled;
+};
+
+ECF_PRAGMA_ENABLE_OPTIMIZATION
\ No newline at end of file
@@ -0,0 +1,109 @@
+// Copyright (c) 2026 Damian Nowakowski. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/SharedPointer.h"
+
+ECF_PRAGMA_DISABLE_OPTIMIZATION
+
+// Data of the current frame passed to clock sources.
+struct FECFClockContext
+{
+	// World of the ECF subsystem. Can be null.
+	UWorld* World = nullptr;
+
+	// Real time of the frame, without time dilation.
+	float DeltaTime = 0.f;
+
+	// Indicates if the game is paused.
+	bool bIsWorldPaused = false;
+
+	// Global time dilation of the world.
+	float TimeDilation = 1.f;
+};
+
+/**
+ * Source of time for actions which use a custom clock.
+ * Clocks are registered in the subsystem with FFlow::RegisterClock and assigned to actions using FECFActionSettings().WithClock(ClockName).
+ * The delta of every clock is computed once per frame and applied to all actions using it.
+ * All functions are called on the Game Thread.
+ */
+class ENHANCEDCODEFLOW_API FECFClockSource
+{
+
+public:
+
+	virtual ~FECFClockSource() {}
+
+	// Returns the time that has passed on this clock since the last frame. 
+	// Actions using this clock are not ticked in the frame in which the returned time is 0 or less.
+	virtual float Advance(const FECFClockContext& Context) = 0;
+};
+
+/**
+ * Real time clock. Ignores the game pause and the global time dilation.
+ */
+class ENHANCEDCODEFLOW_API FECFRealTimeClock : public FECFClockSource
+{
+
+public:
+
+	float Advance(const FECFClockContext& Context) override;
+
+private:
+
+	// Platform time of the previous frame. Negative before the first frame.
+	double LastTime = -1.0;
+};
+
+/**
+ * Clock following the server world time (AGameStateBase::GetServerWorldTimeSeconds), 
+ * so actions on clients stay in sync with the server time.
+ */
+class ENHANCEDCODEFLOW_API FECFServerTimeClock : public FECFClockSource
+{
+
+public:
+
+	float Advance(const FECFClockContext& Context) override;
+
+private:
+
+	// Server world time of the previous frame. Negative before the first frame.
+	double LastTime = -1.0;
+};
+
+/**
+ * Game time clock with its own time scale, applied on top of the global time dilation. Stops when the game is paused.
+ * Useful for gameplay clocks like bullet time affecting only a part of the game.
+ */
+class ENHANCEDCODEFLOW_API FECFScaledClock : public FECFClockSource
+{
+
+public:
+
+	FECFScaledClock(float InTimeScale = 1.f) :
+		TimeScale(InTimeScale)
+	{
+	}
+
+	float Advance(const FECFClockContext& Context) override;
+
+	// Changes the time scale of this clock. 0 stops the clock.
+	void SetTimeScale(float InTimeScale)
+	{
+		TimeScale = FMath::Max(InTimeScale, 0.f);
+	}
+
+	float GetTimeScale() const
+	{
+		return TimeScale;
+	}
+
+private:
+
+	float TimeScale = 1.f;
+};
+
+ECF_PRAGMA_ENABLE_OPTIMIZATION
\ No newline at end of file
@@ -0,0 +1,113 @@
+// Copyright (c) 2026 Damian Nowakowski. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ECFHandle.h"
+
+ECF_PRAGMA_DISABLE_OPTIMIZATION
+
+// Possible commands controlling running actions.
+enum class EECFActionCommand : uint8
+{
+	Stop,
+	Pause,
+	Resume,
+	Reset,
+	SetTime
+};
+
+// Single command controlling the action pointed by the handle.
+struct FECFActionCommand
+{
+	FECFHandle Handle;
+	EECFActionCommand Command = EECFActionCommand::Stop;
+
+	// bComplete for Stop, bCallUpdate for Reset and SetTime.
+	bool bFlag = false;
+
+	// New action time for SetTime.
+	float Time = 0.f;
+};
+
+/**
+ * Records commands controlling actions, so they can be applied later in one pass.
+ * The buffer can be recorded on any thread. Commands are applied in the order they were recorded.
+ * Usage:
+ * FFlow::QueueCommands(this, FECFCommandBuffer().PauseAction(HandleA).StopAction(HandleB, true));
+ */
+class ENHANCEDCODEFLOW_API FECFCommandBuffer
+{
+
+public:
+
+	// Stops the action. bComplete indicates if the action should be completed when stopped.
+	FECFCommandBuffer& StopAction(const FECFHandle& Handle, bool bComplete = false)
+	{
+		return AddCommand(Handle, EECFActionCommand::Stop, bComplete);
+	}
+
+	// Pauses ticking in the action.
+	FECFCommandBuffer& PauseAction(const FECFHandle& Handle)
+	{
+		return AddCommand(Handle, EECFActionCommand::Pause);
+	}
+
+	// Resumes ticking in the action.
+	FECFCommandBuffer& ResumeAction(const FECFHandle& Handle)
+	{
+		return AddCommand(Handle, EECFActionCommand::Resume);
+	}
+
+	// Resets the action. Have in mind that not every action has reset functionality.
+	FECFCommandBuffer& ResetAction(const FECFHandle& Handle, bool bCallUpdate)
+	{
+		return AddCommand(Handle, EECFActionCommand::Reset, bCallUpdate);
+	}
+
+	// Sets the action time. Have in mind that not every action supports time tracking.
+	FECFCommandBuffer& SetActionTime(const FECFHandle& Handle, float NewTime, bool bCallUpdate)
+	{
+		return AddCommand(Handle, EECFActionCommand::SetTime, bCallUpdate, NewTime);
+	}
+
+	// Returns all recorded commands.
+	const TArray<FECFActionCommand>& GetCommands() const
+	{
+		return Commands;
+	}
+
+	// Returns the number of recorded commands.
+	int32 Num() const
+	{
+		return Commands.Num();
+	}
+
+	// Checks if there are any recorded commands.
+	bool IsEmpty() const
+	{
+		return Commands.Num() == 0;
+	}
+
+	// Removes all recorded commands, keeping the memory for the next recording.
+	void Reset()
+	{
+		Commands.Reset();
+	}
+
+private:
+
+	FECFCommandBuffer& AddCommand(const FECFHandle& Handle, EECFActionCommand Command, bool bFlag = false, float Time = 0.f)
+	{
+		FECFActionCommand& NewCommand = Commands.AddDefaulted_GetRef();
+		NewCommand.Handle = Handle;
+		NewCommand.Command = Command;
+		NewCommand.bFlag = bFlag;
+		NewCommand.Time = Time;
+		return *this;
+	}
+
+	TArray<FECFActionCommand> Commands;
+};
+
+ECF_PRAGMA_ENABLE_OPTIMIZATION
\ No newline at end of file
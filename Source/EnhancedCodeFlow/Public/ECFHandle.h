@@ -16,6 +16,11 @@ public:
 	{
 	}
 
+	explicit FECFHandle(uint64 InHandle) :
+		Handle(InHandle)
+	{
+	}
+
 	FECFHandle(const FECFHandle& Other) :
 		Handle(Other.Handle)
 	{
@@ -73,6 +78,12 @@ public:
 		return *this;
 	}
 
+	// Hash the handle, so it can be used as a map key.
+	friend uint32 GetTypeHash(const FECFHandle& InHandle)
+	{
+		return GetTypeHash(InHandle.Handle);
+	}
+
 	// Convert the handle to string.
 	FString ToString() const
 	{
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "ECFTypes.h"
+#include "Templates/Atomic.h"
 
 ECF_PRAGMA_DISABLE_OPTIMIZATION
 
@@ -75,7 +76,7 @@ public:
 		return FString::Printf(TEXT("%llu"), Id);
 	}
 
-	// Returns a new id.
+	// Returns a new id. Can be called from any thread.
 	static FECFInstanceId NewId();
 
 protected:
@@ -84,7 +85,7 @@ protected:
 
 private:
 	
-	static uint64 DynamicIdCounter;
+	static TAtomic<uint64> DynamicIdCounter;
 };
 
 ECF_PRAGMA_ENABLE_OPTIMIZATION
\ No newline at end of file
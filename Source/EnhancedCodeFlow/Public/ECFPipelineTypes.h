@@ -0,0 +1,203 @@
+// Copyright (c) 2026 Damian Nowakowski. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/Optional.h"
+#include "Templates/UniquePtr.h"
+#include "UObject/SoftObjectPath.h"
+#include "ECFCancellationToken.h"
+
+ECF_PRAGMA_DISABLE_OPTIMIZATION
+
+// Execution context of the pipeline stage.
+enum class EECFPipelineContext : uint8
+{
+	// Runs on the Game Thread.
+	GameThread,
+
+	// Runs on a background thread. Consecutive worker stages run one after another without returning to the Game Thread.
+	Worker,
+
+	// Streams the assets returned by the stage function (called on the Game Thread) and waits until they are loaded.
+	LoadAssets
+};
+
+// Timing of a single pipeline stage. Times are in seconds, measured from the start of the pipeline.
+struct FECFPipelineStageTiming
+{
+	FName Name;
+	EECFPipelineContext Context = EECFPipelineContext::GameThread;
+	double StartTime = 0.0;
+	double Duration = 0.0;
+};
+
+// Report passed to the pipeline callback.
+struct FECFPipelineReport
+{
+	// Indicates if the pipeline has been stopped before all stages have finished.
+	bool bStopped = false;
+
+	// Number of stages that have finished.
+	int32 CompletedStages = 0;
+
+	// Time from the start of the pipeline to its end.
+	double TotalTime = 0.0;
+
+	// Timings of the stages that have finished.
+	TArray<FECFPipelineStageTiming> Stages;
+};
+
+// Type erased pipeline payload.
+struct FECFPipelinePayloadBase
+{
+	virtual ~FECFPipelinePayloadBase() {}
+};
+
+template<typename TPayload>
+struct TECFPipelinePayload : public FECFPipelinePayloadBase
+{
+	TECFPipelinePayload(TPayload&& InValue) :
+		Value(MoveTemp(InValue))
+	{
+	}
+
+	TPayload Value;
+};
+
+// Single stage of the pipeline. Stage functions have the payload already bound.
+struct FECFPipelineStage
+{
+	FName Name;
+	EECFPipelineContext Context = EECFPipelineContext::GameThread;
+	TUniqueFunction<void(const FECFCancellationToken&)> Run;
+	TUniqueFunction<TArray<FSoftObjectPath>()> GetAssets;
+};
+
+/**
+ * Type erased description of the pipeline run by the Run Pipeline action. Use TECFPipeline to build it.
+ */
+class ENHANCEDCODEFLOW_API FECFPipeline
+{
+	friend class UECFRunPipeline;
+
+public:
+
+	// Checks if the pipeline has a payload, stages and the callback.
+	bool IsValid() const
+	{
+		return Payload.IsValid() && Stages.Num() > 0 && Callback;
+	}
+
+protected:
+
+	TUniquePtr<FECFPipelinePayloadBase> Payload;
+	TArray<FECFPipelineStage> Stages;
+
+	// Called on the Game Thread when the pipeline ends. The payload can be passed only if no worker stage is using it.
+	TUniqueFunction<void(bool/* bHasPayload*/, const FECFPipelineReport&)> Callback;
+};
+
+/**
+ * Builds the pipeline of stages processing the typed payload. The payload is moved between stages without copying.
+ * Usage:
+ * FFlow::RunPipeline(this, TECFPipeline<FMyChunk>(MoveTemp(Chunk))
+ *   .LoadAssets(TEXT("Load"), [](FMyChunk& Chunk) { return Chunk.AssetsToLoad; })
+ *   .OnWorker(TEXT("PostProcess"), [](FMyChunk& Chunk, const FECFCancellationToken& CancellationToken) { ... })
+ *   .OnGameThread(TEXT("Finalize"), [this](FMyChunk& Chunk) { ... })
+ *   .OnWorker(TEXT("WriteCache"), [](FMyChunk& Chunk, const FECFCancellationToken& CancellationToken) { ... }),
+ *   [this](TOptional<FMyChunk>&& Chunk, const FECFPipelineReport& Report) { ... });
+ */
+template<typename TPayload>
+class TECFPipeline : public FECFPipeline
+{
+
+public:
+
+	TECFPipeline(TPayload InPayload = TPayload())
+	{
+		TECFPipelinePayload<TPayload>* NewPayload = new TECFPipelinePayload<TPayload>(MoveTemp(InPayload));
+		PayloadValue = &NewPayload->Value;
+		Payload = TUniquePtr<FECFPipelinePayloadBase>(NewPayload);
+	}
+
+	// Adds the stage running on the Game Thread.
+	TECFPipeline& OnGameThread(FName StageName, TUniqueFunction<void(TPayload&)>&& StageFunc) &
+	{
+		FECFPipelineStage& Stage = AddStage(StageName, EECFPipelineContext::GameThread);
+		Stage.Run = [Value = PayloadValue, Func = MoveTemp(StageFunc)](const FECFCancellationToken& CancellationToken)
+		{
+			Func(*Value);
+		};
+		return *this;
+	}
+
+	TECFPipeline&& OnGameThread(FName StageName, TUniqueFunction<void(TPayload&)>&& StageFunc) &&
+	{
+		return MoveTemp(OnGameThread(StageName, MoveTemp(StageFunc)));
+	}
+
+	// Adds the stage running on a background thread.
+	TECFPipeline& OnWorker(FName StageName, TUniqueFunction<void(TPayload&, const FECFCancellationToken&)>&& StageFunc) &
+	{
+		FECFPipelineStage& Stage = AddStage(StageName, EECFPipelineContext::Worker);
+		Stage.Run = [Value = PayloadValue, Func = MoveTemp(StageFunc)](const FECFCancellationToken& CancellationToken)
+		{
+			Func(*Value, CancellationToken);
+		};
+		return *this;
+	}
+
+	TECFPipeline&& OnWorker(FName StageName, TUniqueFunction<void(TPayload&, const FECFCancellationToken&)>&& StageFunc) &&
+	{
+		return MoveTemp(OnWorker(StageName, MoveTemp(StageFunc)));
+	}
+
+	// Adds the stage loading the assets returned by the given function (called on the Game Thread).
+	TECFPipeline& LoadAssets(FName StageName, TUniqueFunction<TArray<FSoftObjectPath>(TPayload&)>&& StageFunc) &
+	{
+		FECFPipelineStage& Stage = AddStage(StageName, EECFPipelineContext::LoadAssets);
+		Stage.GetAssets = [Value = PayloadValue, Func = MoveTemp(StageFunc)]()
+		{
+			return Func(*Value);
+		};
+		return *this;
+	}
+
+	TECFPipeline&& LoadAssets(FName StageName, TUniqueFunction<TArray<FSoftObjectPath>(TPayload&)>&& StageFunc) &&
+	{
+		return MoveTemp(LoadAssets(StageName, MoveTemp(StageFunc)));
+	}
+
+	// Sets the callback called on the Game Thread when the pipeline ends. 
+	// Must be: [](TOptional<TPayload>&& Payload, const FECFPipelineReport& Report) -> void.
+	// The payload is empty if the pipeline has been stopped while a worker stage was using it.
+	template<typename TCallback>
+	void SetCallback(TCallback&& InCallback)
+	{
+		Callback = [Value = PayloadValue, Func = Forward<TCallback>(InCallback)](bool bHasPayload, const FECFPipelineReport& Report) mutable
+		{
+			TOptional<TPayload> FinishedPayload;
+			if (bHasPayload)
+			{
+				FinishedPayload = MoveTemp(*Value);
+			}
+			Func(MoveTemp(FinishedPayload), Report);
+		};
+	}
+
+private:
+
+	FECFPipelineStage& AddStage(FName StageName, EECFPipelineContext Context)
+	{
+		FECFPipelineStage& Stage = Stages.AddDefaulted_GetRef();
+		Stage.Name = StageName;
+		Stage.Context = Context;
+		return Stage;
+	}
+
+	// Typed payload owned by the type erased Payload. Its address doesn't change when the pipeline is moved.
+	TPayload* PayloadValue = nullptr;
+};
+
+ECF_PRAGMA_ENABLE_OPTIMIZATION
\ No newline at end of file
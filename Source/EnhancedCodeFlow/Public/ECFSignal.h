@@ -0,0 +1,66 @@
+// Copyright (c) 2026 Damian Nowakowski. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "Templates/Atomic.h"
+#include "Templates/SharedPointer.h"
+#include "ECFAsyncCompletion.h"
+
+ECF_PRAGMA_DISABLE_OPTIMIZATION
+
+/**
+ * Thread safe flag which wakes up actions waiting for it (e.g. FFlow::WaitForSignal) when it is set.
+ * Waiting actions are parked, so they don't tick at all. Setting the signal from any thread
+ * enqueues their wake up on the Game Thread.
+ * Copies of the signal share the same state.
+ */
+class ENHANCEDCODEFLOW_API FECFSignal
+{
+	friend class UECFWaitForSignal;
+
+public:
+
+	FECFSignal() :
+		State(MakeShared<FState, ESPMode::ThreadSafe>())
+	{
+	}
+
+	// Sets the signal and wakes up all actions waiting for it. Can be called from any thread.
+	void Set() const;
+
+	// Clears the signal, so the next waits will wait until it is set again. Can be called from any thread.
+	void Reset() const;
+
+	// Checks if the signal is set. Can be called from any thread.
+	bool IsSet() const
+	{
+		return State->bIsSet.Load(EMemoryOrder::Relaxed);
+	}
+
+private:
+
+	// Registers the action waiting for the signal. Returns false if the signal is already set.
+	bool AddWaiter(const UECFActionBase* InAction, FECFAsyncCompletion&& InCompletion) const;
+
+	// Unregisters the action waiting for the signal.
+	void RemoveWaiter(const UECFActionBase* InAction) const;
+
+	struct FWaiter
+	{
+		const UECFActionBase* Action = nullptr;
+		FECFAsyncCompletion Completion;
+	};
+
+	struct FState
+	{
+		TAtomic<bool> bIsSet = false;
+		FCriticalSection WaitersLock;
+		TArray<FWaiter> Waiters;
+	};
+
+	TSharedRef<FState, ESPMode::ThreadSafe> State;
+};
+
+ECF_PRAGMA_ENABLE_OPTIMIZATION
\ No newline at end of file
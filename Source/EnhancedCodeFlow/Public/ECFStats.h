@@ -9,6 +9,16 @@ DECLARE_STATS_GROUP(TEXT("ECF"), STATGROUP_ECF, STATCAT_Advanced);
 DECLARE_STATS_GROUP(TEXT("ECFDetails"), STATGROUP_ECFDETAILS, STATCAT_Advanced);
 DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Actions"), STAT_ECF_ActionsCount, STATGROUP_ECF, ENHANCEDCODEFLOW_API);
 DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Instances"), STAT_ECF_InstancesCount, STATGROUP_ECF, ENHANCEDCODEFLOW_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Pre Physics Actions"), STAT_ECF_PrePhysicsActionsCount, STATGROUP_ECF, ENHANCEDCODEFLOW_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Post Physics Actions"), STAT_ECF_PostPhysicsActionsCount, STATGROUP_ECF, ENHANCEDCODEFLOW_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("End Of Frame Actions"), STAT_ECF_EndOfFrameActionsCount, STATGROUP_ECF, ENHANCEDCODEFLOW_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Parked Actions"), STAT_ECF_ParkedActionsCount, STATGROUP_ECF, ENHANCEDCODEFLOW_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Async Tasks In Flight"), STAT_ECF_AsyncTasksInFlightCount, STATGROUP_ECF, ENHANCEDCODEFLOW_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Queued Async Tasks"), STAT_ECF_QueuedAsyncTasksCount, STATGROUP_ECF, ENHANCEDCODEFLOW_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Async Pipes"), STAT_ECF_AsyncPipesCount, STATGROUP_ECF, ENHANCEDCODEFLOW_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Deferred Actions"), STAT_ECF_DeferredActionsCount, STATGROUP_ECF, ENHANCEDCODEFLOW_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Parallel Ticked Actions"), STAT_ECF_ParallelTickedActionsCount, STATGROUP_ECF, ENHANCEDCODEFLOW_API);
+DECLARE_FLOAT_COUNTER_STAT_EXTERN(TEXT("Tick Budget Overrun (ms)"), STAT_ECF_TickBudgetOverrun, STATGROUP_ECF, ENHANCEDCODEFLOW_API);
 DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Action Objects"), STAT_ECF_ActionsObjectsCount, STATGROUP_ECF, ENHANCEDCODEFLOW_API);
 DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Async BP Objects"), STAT_ECF_AsyncBPObjectsCount, STATGROUP_ECF, ENHANCEDCODEFLOW_API);
 #endif
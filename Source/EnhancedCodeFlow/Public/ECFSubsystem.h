@@ -5,10 +5,21 @@
 #include "CoreMinimal.h"
 #include "Subsystems/GameInstanceSubsystem.h"
 #include "Tickable.h"
+#include "Containers/Queue.h"
+#include "Templates/Atomic.h"
+#include "UObject/ObjectKey.h"
+#include "Engine/EngineTypes.h"
 #include "ECFHandle.h"
 #include "ECFActionBase.h"
 #include "ECFInstanceId.h"
 #include "ECFActionSettings.h"
+#include "ECFCommandBuffer.h"
+#include "ECFAsyncCompletion.h"
+#include "ECFAsyncLane.h"
+#include "ECFAsyncPipes.h"
+#include "ECFClock.h"
+#include "ECFTickLOD.h"
+#include "ECFTickFunction.h"
 #include "ECFStats.h"
 #include "Coroutines/ECFCoroutine.h"
 #include "ECFLogs.h"
@@ -16,6 +27,25 @@
 
 ECF_PRAGMA_DISABLE_OPTIMIZATION
 
+// Actions ticked in one tick group.
+USTRUCT()
+struct FECFTickGroupActions
+{
+	GENERATED_BODY()
+
+	// List of active actions.
+	UPROPERTY(Transient)
+	TArray<UECFActionBase*> Actions;
+
+	// List of nodes to be add in the next tick of this group.
+	UPROPERTY(Transient)
+	TArray<UECFActionBase*> PendingAddActions;
+
+	// Number of actions and instanced actions kept after the last tick of this group. Used by stats.
+	int32 ActionsNum = 0;
+	int32 InstancesNum = 0;
+};
+
 UCLASS()
 class ENHANCEDCODEFLOW_API UECFSubsystem : public UGameInstanceSubsystem, public FTickableGameObject
 {
@@ -23,6 +53,14 @@ class ENHANCEDCODEFLOW_API UECFSubsystem : public UGameInstanceSubsystem, public
 
 	friend class FEnhancedCodeFlow;
 	friend class FECFCoroutineAwaiter;
+	friend class UECFActionBase;
+	friend class FECFAsyncCompletion;
+	friend struct FECFTickFunction;
+
+public:
+
+	// Maximum number of actions which can join a single sweep of actions. Actions over the limit start in the next tick.
+	static constexpr int32 MaxImmediateActivationsPerSweep = 256;
 
 protected:
 
@@ -37,19 +75,40 @@ protected:
 	bool IsTickableWhenPaused() const override { return true; }
 
 	// Add Action to list. Returns the Action id.
+	// Actions can be added from any thread. Actions added outside of the Game Thread are queued
+	// and created at the beginning of the next subsystem tick, but their handle is reserved and returned immediately.
 	template<typename T, typename ... Ts>
 	FECFHandle AddAction(const UObject* InOwner, const FECFActionSettings& Settings, const FECFInstanceId& InstanceId, Ts&& ... Args)
 	{
-		// Ensure the Action has been started from the Game Thread.
 		if (IsInGameThread() == false)
 		{
-#if ECF_LOGS
-			UE_LOG(LogECF, Error, TEXT("ECF Actions must be started from the Game Thread!"));
-#endif
-			checkf(false, TEXT("ECF Actions must be started from the Game Thread!"));
-			return FECFHandle();
+			return QueueAction<T>(InOwner, Settings, InstanceId, Forward<Ts>(Args)...);
+		}
+
+		return CreateAction<T>(InOwner, Settings, InstanceId, ReserveHandleId(), Forward<Ts>(Args)...);
+	}
+
+	// Add Coroutine Action to List.
+	// Coroutine Actions can be added from any thread. Actions added outside of the Game Thread are queued
+	// and created at the beginning of the next subsystem tick.
+	template<typename T, typename ... Ts>
+	void AddCoroutineAction(const UObject* InOwner, FECFCoroutineHandle InCoroutineHandle, const FECFActionSettings& Settings, Ts&& ... Args)
+	{
+		if (IsInGameThread() == false)
+		{
+			QueueCoroutineAction<T>(InOwner, InCoroutineHandle, Settings, Forward<Ts>(Args)...);
+			return;
 		}
 
+		CreateCoroutineAction<T>(InOwner, InCoroutineHandle, Settings, ReserveHandleId(), Forward<Ts>(Args)...);
+	}
+
+	// Creates the Action with the already reserved handle and adds it to the list. Must be called from the Game Thread.
+	template<typename T, typename ... Ts>
+	FECFHandle CreateAction(const UObject* InOwner, const FECFActionSettings& InSettings, const FECFInstanceId& InstanceId, const FECFHandle& InHandleId, Ts&& ... Args)
+	{
+		check(IsInGameThread());
+
 		// There can be only one instanced action running at the same time. When trying to add an
 		// action with existing instance id - return the currently running action's handle.
 		UECFActionBase* PossibleInstancedAction = GetInstancedAction(InstanceId, false);
@@ -62,19 +121,32 @@ protected:
 
 		// Otherwise, create and set new action.
 		T* NewAction = NewObject<T>(this);
-		NewAction->SetAction(InOwner, ++LastHandleId, InstanceId, Settings);
+		NewAction->SetAction(InOwner, InHandleId, InstanceId, InSettings);
+		NewAction->ClockIndex = GetClockIndex(NewAction->Settings);
+		if (InSettings.bUseTickLOD)
+		{
+			NewAction->TickLODPhase = NextTickLODPhase++;
+		}
 		if (NewAction->Setup(Forward<Ts>(Args)...))
 		{
 			NewAction->Init();
-			PendingAddActions.Add(NewAction);
+			if (NewAction->Settings->bSpreadTickPhase && NewAction->Settings->TickInterval > 0.f)
+			{
+				SpreadTickPhase(NewAction);
+			}
+			AddPendingAction(NewAction);
+			if (NewAction->Settings->bTrackOwnerLifetime)
+			{
+				TrackOwnerLifetime(NewAction);
+			}
 #if (ECF_LOGS && ECF_LOGS_VERBOSE)
 			if (InstanceId.IsValid())
 			{
-				UE_LOG(LogECF, Verbose, TEXT("Started Instanced Action of class: %s, with HandleId: %s, and InstanceId: %s, Label: %s"), *NewAction->GetName(), *LastHandleId.ToString(), *InstanceId.ToString(), *Settings.Label);
+				UE_LOG(LogECF, Verbose, TEXT("Started Instanced Action of class: %s, with HandleId: %s, and InstanceId: %s, Label: %s"), *NewAction->GetName(), *InHandleId.ToString(), *InstanceId.ToString(), *InSettings.Label);
 			}
 			else
 			{
-				UE_LOG(LogECF, Verbose, TEXT("Started Action of class: %s, with HandleId: %s, Label: %s"), *NewAction->GetName(), *LastHandleId.ToString(), *Settings.Label);
+				UE_LOG(LogECF, Verbose, TEXT("Started Action of class: %s, with HandleId: %s, Label: %s"), *NewAction->GetName(), *InHandleId.ToString(), *InSettings.Label);
 			}
 #endif
 			return NewAction->GetHandleId();
@@ -82,7 +154,7 @@ protected:
 		else
 		{
 #if ECF_LOGS
-			UE_LOG(LogECF, Error, TEXT("Failed to Setup Action of class: %s, Label: %s"), *NewAction->GetName(), *Settings.Label);
+			UE_LOG(LogECF, Error, TEXT("Failed to Setup Action of class: %s, Label: %s"), *NewAction->GetName(), *InSettings.Label);
 #endif
 		}
 
@@ -90,35 +162,40 @@ protected:
 		return FECFHandle();
 	}
 
-	// Add Coroutine Action to List.
+	// Creates the Coroutine Action with the already reserved handle and adds it to the list. Must be called from the Game Thread.
 	template<typename T, typename ... Ts>
-	void AddCoroutineAction(const UObject* InOwner, FECFCoroutineHandle InCoroutineHandle, const FECFActionSettings& Settings, Ts&& ... Args)
+	void CreateCoroutineAction(const UObject* InOwner, FECFCoroutineHandle InCoroutineHandle, const FECFActionSettings& InSettings, const FECFHandle& InHandleId, Ts&& ... Args)
 	{
-		// Ensure the Action has been started from the Game Thread.
-		if (IsInGameThread() == false)
-		{
-#if ECF_LOGS
-			UE_LOG(LogECF, Error, TEXT("ECF Coroutines must be started from the Game Thread!"));
-#endif
-			checkf(false, TEXT("ECF Coroutines must be started from the Game Thread!"));
-			return;
-		}
+		check(IsInGameThread());
 
 		// Create and set new coroutine action.
 		T* NewAction = NewObject<T>(this);
-		NewAction->SetCoroutineAction(InOwner, InCoroutineHandle, ++LastHandleId, Settings);
+		NewAction->SetCoroutineAction(InOwner, InCoroutineHandle, InHandleId, InSettings);
+		NewAction->ClockIndex = GetClockIndex(NewAction->Settings);
+		if (InSettings.bUseTickLOD)
+		{
+			NewAction->TickLODPhase = NextTickLODPhase++;
+		}
 		if (NewAction->Setup(Forward<Ts>(Args)...))
 		{
 			NewAction->Init();
 #if (ECF_LOGS && ECF_LOGS_VERBOSE)
-			UE_LOG(LogECF, Verbose, TEXT("Started Coroutine Action of class: %s, Label: %s"), *NewAction->GetName(), *Settings.Label);
+			UE_LOG(LogECF, Verbose, TEXT("Started Coroutine Action of class: %s, Label: %s"), *NewAction->GetName(), *InSettings.Label);
 #endif
-			PendingAddActions.Add(NewAction);
+			if (NewAction->Settings->bSpreadTickPhase && NewAction->Settings->TickInterval > 0.f)
+			{
+				SpreadTickPhase(NewAction);
+			}
+			AddPendingAction(NewAction);
+			if (NewAction->Settings->bTrackOwnerLifetime)
+			{
+				TrackOwnerLifetime(NewAction);
+			}
 		}
 		else
 		{
 #if ECF_LOGS
-			UE_LOG(LogECF, Error, TEXT("Failed to Setup Coroutine Action of class: %s, Label: %s"), *NewAction->GetName(), *Settings.Label);
+			UE_LOG(LogECF, Error, TEXT("Failed to Setup Coroutine Action of class: %s, Label: %s"), *NewAction->GetName(), *InSettings.Label);
 #endif
 			// Immediately resume the coroutine if the action couldn't be created for any reason, 
 			// so that it can continue executing and not be stuck in a suspended state.
@@ -126,6 +203,63 @@ protected:
 		}
 	}
 
+	// Queues the Action to be created at the beginning of the next tick. Can be called from any thread.
+	// Returns the handle reserved for the Action. Note that if an instanced action with the same InstanceId
+	// is already running when the queue is processed, no new action is created and the reserved handle stays unused.
+	template<typename T, typename ... Ts>
+	FECFHandle QueueAction(const UObject* InOwner, const FECFActionSettings& Settings, const FECFInstanceId& InstanceId, Ts&& ... Args)
+	{
+		const FECFHandle ReservedHandleId = ReserveHandleId();
+		QueuedActions.Enqueue([this, WeakOwner = TWeakObjectPtr<const UObject>(InOwner), QueuedSettings = Settings, InstanceId, ReservedHandleId, QueuedArgs = MakeTuple(Forward<Ts>(Args)...)]() mutable
+		{
+			CreateQueuedAction<T>(WeakOwner.Get(), QueuedSettings, InstanceId, ReservedHandleId, QueuedArgs, TMakeIntegerSequence<uint32, sizeof...(Ts)>());
+		});
+		return ReservedHandleId;
+	}
+
+	// Queues the Coroutine Action to be created at the beginning of the next tick. Can be called from any thread.
+	template<typename T, typename ... Ts>
+	void QueueCoroutineAction(const UObject* InOwner, FECFCoroutineHandle InCoroutineHandle, const FECFActionSettings& Settings, Ts&& ... Args)
+	{
+		const FECFHandle ReservedHandleId = ReserveHandleId();
+		QueuedActions.Enqueue([this, WeakOwner = TWeakObjectPtr<const UObject>(InOwner), InCoroutineHandle, QueuedSettings = Settings, ReservedHandleId, QueuedArgs = MakeTuple(Forward<Ts>(Args)...)]() mutable
+		{
+			CreateQueuedCoroutineAction<T>(WeakOwner.Get(), InCoroutineHandle, QueuedSettings, ReservedHandleId, QueuedArgs, TMakeIntegerSequence<uint32, sizeof...(Ts)>());
+		});
+	}
+
+	// Unpacks the arguments of the queued Action.
+	template<typename T, typename TupleType, uint32 ... Indices>
+	void CreateQueuedAction(const UObject* InOwner, const FECFActionSettings& InSettings, const FECFInstanceId& InstanceId, const FECFHandle& InHandleId, TupleType& QueuedArgs, TIntegerSequence<uint32, Indices...>)
+	{
+		CreateAction<T>(InOwner, InSettings, InstanceId, InHandleId, MoveTemp(QueuedArgs.template Get<Indices>())...);
+	}
+
+	// Unpacks the arguments of the queued Coroutine Action.
+	template<typename T, typename TupleType, uint32 ... Indices>
+	void CreateQueuedCoroutineAction(const UObject* InOwner, FECFCoroutineHandle InCoroutineHandle, const FECFActionSettings& InSettings, const FECFHandle& InHandleId, TupleType& QueuedArgs, TIntegerSequence<uint32, Indices...>)
+	{
+		CreateCoroutineAction<T>(InOwner, InCoroutineHandle, InSettings, InHandleId, MoveTemp(QueuedArgs.template Get<Indices>())...);
+	}
+
+	// Creates all Actions queued from other threads.
+	void CreateQueuedActions();
+
+	// Reserves a new Action handle. Can be called from any thread.
+	FECFHandle ReserveHandleId()
+	{
+		return FECFHandle(++LastHandleId);
+	}
+
+	// Queues the commands to be applied at the beginning of the next tick. Can be called from any thread.
+	void QueueCommands(FECFCommandBuffer&& Commands);
+
+	// Applies all commands queued from other threads.
+	void ApplyQueuedCommands();
+
+	// Applies the commands in the order they were recorded, resolving all their handles in one pass. Must be called from the Game Thread.
+	void ApplyCommands(TArrayView<const FECFActionCommand> Commands);
+
 	// Try to find running or pending action based on it's handle.
 	UECFActionBase* FindAction(const FECFHandle& HandleId) const;
 
@@ -189,22 +323,292 @@ protected:
 	// Get the time value associated with the action. Returns -1 if there is no action or if that action doesn't support time tracking.
 	float GetActionTime(const FECFHandle& HandleId);
 
+	// Get the progress of the action in range [0, 1]. Returns -1 if there is no action or if that action doesn't support progress tracking.
+	float GetActionProgress(const FECFHandle& HandleId);
+
 	// Set the time value associated with the action. Returns false if there is no action or if that action doesn't support time tracking.
 	bool SetActionTime(const FECFHandle& HandleId, float NewTime, bool bCallUpdate);
 
 	// Check if there is an instanced action running with the given instance id and returns it.
 	UECFActionBase* GetInstancedAction(const FECFInstanceId& InstanceId, bool bPrintErrorIfFailed = true) const;
 	
-	// List of active actions.
+	// Number of tick groups, including the Default one.
+	static constexpr int32 TickGroupsNum = static_cast<int32>(EECFTickGroup::EndOfFrame) + 1;
+
+	// Actions of every tick group, indexed by EECFTickGroup. Every group keeps its own list of actions.
 	UPROPERTY(Transient)
-	TArray<UECFActionBase*> Actions;
+	TArray<FECFTickGroupActions> TickGroups;
+
+	// Tick functions registered with the world, indexed by EECFTickGroup.
+	// The Default group is ticked by the subsystem itself, so its tick function is never registered.
+	FECFTickFunction TickFunctions[TickGroupsNum];
 
-	// List of nodes to be add in the future.
+	// Returns the actions of the tick group in which the given action is ticked.
+	FECFTickGroupActions& GetTickGroupActions(const UECFActionBase* Action)
+	{
+		return TickGroups[static_cast<int32>(Action->Settings->TickGroup)];
+	}
+
+	// Adds the action to pending actions of its tick group, so it will be ticked in the next tick of that group.
+	void AddPendingAction(UECFActionBase* Action);
+
+	// Registers the tick function of the given group in the current world, if it hasn't been registered there yet.
+	void RegisterTickFunction(EECFTickGroup Group);
+
+	// Ticks actions of the tick group other than the Default one. Called by the group's tick function.
+	void TickInGroup(EECFTickGroup Group);
+
+	// Ticks all actions of the tick group in a single sweep. Every action is ticked with the delta time of its clock.
+	void TickActions(FECFTickGroupActions& TickGroupActions);
+
+	// Actions of the tick group which sweep is in progress. Actions with immediate activation of this group join the sweep.
+	FECFTickGroupActions* SweptGroupActions = nullptr;
+
+	// Number of actions which have joined the current sweep, limited to guard against unbounded chains of new actions.
+	// The limit is checked by the EnhancedCodeFlow.Tick.ImmediateActivation automation test.
+	int32 ImmediateActivationsNum = 0;
+
+	// Calls the function for every list of actions: active actions of every tick group, 
+	// then pending actions of every tick group and finally parked actions.
+	template<typename TFunc>
+	void ForEachActionsList(TFunc&& Func) const
+	{
+		for (const FECFTickGroupActions& TickGroupActions : TickGroups)
+		{
+			Func(TickGroupActions.Actions);
+		}
+		for (const FECFTickGroupActions& TickGroupActions : TickGroups)
+		{
+			Func(TickGroupActions.PendingAddActions);
+		}
+		Func(ParkedActions);
+	}
+
+	// Returns the first action in any list of actions which matches the predicate.
+	template<typename TPredicate>
+	UECFActionBase* FindActionIf(TPredicate&& Predicate) const
+	{
+		UECFActionBase* Result = nullptr;
+		ForEachActionsList([&](const TArray<UECFActionBase*>& ActionsList)
+		{
+			if (Result == nullptr)
+			{
+				if (UECFActionBase* const* ActionFound = ActionsList.FindByPredicate(Predicate))
+				{
+					Result = *ActionFound;
+				}
+			}
+		});
+		return Result;
+	}
+
+	// List of parked actions. They are not ticked until their async work is done or their deadline passes.
 	UPROPERTY(Transient)
-	TArray<UECFActionBase*> PendingAddActions;
+	TArray<UECFActionBase*> ParkedActions;
+
+	// Parked actions to wake up at the beginning of the next tick. Filled from any thread by async completions.
+	TSharedPtr<FECFCompletionQueue, ESPMode::ThreadSafe> CompletionQueue;
+
+	// Deadline of a parked action.
+	struct FECFDeadline
+	{
+		double Time = 0.0;
+		TWeakObjectPtr<UECFActionBase> Action;
+		uint32 Serial = 0;
+
+		bool operator<(const FECFDeadline& Other) const
+		{
+			return Time < Other.Time;
+		}
+	};
+
+	// Time domain in which actions are ticked and deadlines are measured, with a min-heap of deadlines scheduled in it.
+	// The delta time of every clock is computed once per frame and used by all actions of the clock.
+	// Outdated deadlines are not removed from the heap, they are ignored when they are reached.
+	struct FECFClock
+	{
+		double Now = 0.0;
+
+		// Time that has passed on this clock in the current frame.
+		float DeltaTime = 0.f;
+
+		// Indicates if the clock doesn't run in the current frame (e.g. the game is paused), so its actions are not ticked.
+		bool bIsStopped = true;
+
+		TArray<FECFDeadline> Deadlines;
+
+		// Source of time of the custom clock. Null for built-in clocks and for custom clocks which aren't registered.
+		TSharedPtr<FECFClockSource> Source;
+
+		// Clock of actions of an action group is derived from the clock the actions would use without the group.
+		// Its delta time is the delta time of the parent clock, dilated by the group.
+		int32 ParentIndex = INDEX_NONE;
+		int32 ActionGroupIndex = INDEX_NONE;
+	};
+
+	// Action group. Pausing and dilating it is applied by its clocks when their delta times are computed,
+	// so the actions of the group are not touched.
+	struct FECFActionGroup
+	{
+		bool bIsPaused = false;
+		float TimeDilation = 1.f;
+	};
+
+	// Number of built-in clocks, one for every combination of ignoring the game pause and the global time dilation.
+	static constexpr int32 BuiltInClocksNum = 4;
+
+	// Built-in clocks followed by custom clocks. Clocks are never removed, so clock indices cached in actions stay valid.
+	TArray<FECFClock> Clocks;
+
+	// Indices of custom clocks by their names.
+	TMap<FName, int32> CustomClockIndices;
+
+	// Action groups and their indices by names. Groups are never removed.
+	TArray<FECFActionGroup> ActionGroups;
+	TMap<FName, int32> ActionGroupIndices;
+
+	// Indices of clocks of action groups by the indices of their parent clocks and groups.
+	TMap<TPair<int32, int32>, int32> ActionGroupClockIndices;
+
+	// Returns the index of the action group with the given name. Adds the group if it doesn't exist yet.
+	int32 GetActionGroupIndex(FName ActionGroupName);
+
+	// Pauses or resumes all actions of the action group, starting from the next tick.
+	void SetActionGroupPaused(FName ActionGroupName, bool bPaused);
+
+	// Checks if the action group is paused.
+	bool IsActionGroupPaused(FName ActionGroupName) const;
+
+	// Sets the time dilation of all actions of the action group, starting from the next tick.
+	void SetActionGroupTimeDilation(FName ActionGroupName, float TimeDilation);
+
+	// Returns the time dilation of the action group.
+	float GetActionGroupTimeDilation(FName ActionGroupName) const;
+
+	// Frame in which the clocks have been advanced.
+	uint64 ClocksFrame = 0;
+
+	// Returns the index of the clock used by actions with the given settings. 
+	// Adds the custom clock if it doesn't exist yet. It won't run until it is registered.
+	int32 GetClockIndex(const FECFActionSettings* InSettings);
+
+	// Registers the source of the custom clock with the given name, replacing the previous one.
+	void RegisterClock(FName ClockName, const TSharedRef<FECFClockSource>& Source);
+
+	// Unregisters the source of the custom clock. Actions using it are stopped until the clock is registered again.
+	void UnregisterClock(FName ClockName);
+
+	// Indicates if the subsystem is ticking actions right now.
+	bool bIsTicking = false;
+
+	// Time budget of ticking all actions in cycles. 0 means there is no budget.
+	uint64 TickBudgetCycles = 0;
+	float TickBudgetMs = 0.f;
+
+	// The budget is shared by all tick groups in a frame. Cycles used in the frame with the given number.
+	uint64 TickBudgetUsedCycles = 0;
+	uint64 TickBudgetFrame = 0;
+
+	// Number of actions deferred in the current frame. Used by stats.
+	int32 DeferredActionsNum = 0;
+
+	// Number of actions with spread tick phase started so far for every tick interval.
+	TMap<float, uint32> TickPhaseSequences;
+
+	// Shifts the first tick of the interval action, so ticks of actions with the same interval are spread evenly across it.
+	void SpreadTickPhase(UECFActionBase* Action);
 
-	// Id of the last created node.
-	FECFHandle LastHandleId;
+	// Policy of lowering the tick rate of actions with the Tick LOD setting.
+	FECFTickLODPolicy TickLODPolicy;
+
+	// Real time left to the next update of tick LOD levels.
+	float TickLODUpdateTimeLeft = 0.f;
+
+	// Phase given to the next action with the Tick LOD setting.
+	uint8 NextTickLODPhase = 0;
+
+	// Sets the policy of lowering the tick rate of actions with the Tick LOD setting. LOD levels are updated in the next tick.
+	void SetTickLODPolicy(const FECFTickLODPolicy& InPolicy);
+
+	// Updates tick LOD levels of all actions with the Tick LOD setting, if the update interval has passed.
+	// Levels are computed once per owner.
+	void UpdateTickLODs(float DeltaTime);
+
+	// Returns the tick LOD level of the owner, based on its distance from the nearest of the given views.
+	int32 GetTickLODLevel(const UObject* Owner, const TArray<FVector>& ViewLocations) const;
+
+	// Indices of low priority actions waiting for the budget left after ticking other actions. Kept to reuse the memory.
+	TArray<int32> LowPriorityIndices;
+
+	// Thread safe action or action with parallel compute waiting for the parallel tick phase.
+	struct FECFParallelTick
+	{
+		UECFActionBase* Action = nullptr;
+		const UObject* Owner = nullptr;
+		float DeltaTime = 0.f;
+
+		// Indicates if only the state of the action is computed, to be applied on the Game Thread.
+		bool bComputeOnly = false;
+
+		// Index of the next tick of the same owner.
+		int32 NextIndex = INDEX_NONE;
+	};
+
+	// Ticks of all actions of the same owner, linked in the order of the sweep.
+	struct FECFParallelTickPartition
+	{
+		int32 FirstIndex = INDEX_NONE;
+		int32 LastIndex = INDEX_NONE;
+	};
+
+	// Actions collected during the sweep and their partitions. Kept to reuse the memory.
+	TArray<FECFParallelTick> ParallelTicks;
+	TArray<FECFParallelTickPartition> ParallelTickPartitions;
+	TMap<const UObject*, int32> ParallelTickOwners;
+
+	// Number of actions ticked in parallel in the current frame. Used by stats.
+	int32 ParallelTickedActionsNum = 0;
+
+	// Ticks actions collected during the sweep on worker threads, one partition per owner, so actions of the same owner
+	// never tick concurrently. Then applies computed ticks and completes finished actions on the Game Thread.
+	void TickInParallel();
+
+	// Sets the time budget of ticking all actions in milliseconds. 0 removes the budget.
+	void SetTickBudget(float InBudgetMs);
+
+	// Returns the time budget of ticking all actions in milliseconds. 0 means there is no budget.
+	float GetTickBudget() const
+	{
+		return TickBudgetMs;
+	}
+
+	// Async lanes limiting the number of async tasks running at once.
+	TMap<FName, TSharedRef<FECFAsyncLane, ESPMode::ThreadSafe>> AsyncLanes;
+
+	// Returns the async lane with the given name. Creates it, allowing one task at once, if it doesn't exist yet.
+	// Must be called from the Game Thread.
+	TSharedRef<FECFAsyncLane, ESPMode::ThreadSafe> GetAsyncLane(FName LaneName);
+
+	// Sets the maximum number of async tasks running at once in the given lane.
+	void SetAsyncLaneMaxInFlight(FName LaneName, int32 MaxInFlight);
+
+	// Returns the statistics of the given lane. Returns false if there is no such lane.
+	bool GetAsyncLaneStats(FName LaneName, FECFAsyncLaneStats& OutStats) const;
+
+	// Async pipes running async tasks of the same owner one after another.
+	TSharedPtr<FECFAsyncPipes, ESPMode::ThreadSafe> AsyncPipes;
+
+	// Command buffers queued from other threads, applied at the beginning of the next tick.
+	TQueue<FECFCommandBuffer, EQueueMode::Mpsc> QueuedCommands;
+
+	// Commands dequeued in this tick. Kept to reuse the memory.
+	TArray<FECFActionCommand> DequeuedCommands;
+
+	// Id of the last reserved handle. Handles can be reserved from any thread.
+	TAtomic<uint64> LastHandleId;
+
+	// Actions queued from other threads, created at the beginning of the next tick.
+	TQueue<TUniqueFunction<void()>, EQueueMode::Mpsc> QueuedActions;
 
 	// Indicates if subsystem is paused
 	bool bIsECFPaused = false;
@@ -215,9 +619,64 @@ protected:
 	// Helper function to finish action.
 	void FinishAction(UECFActionBase* Action, bool bComplete);
 
+	// Parks the action, so it won't be ticked until it is woken up or the deadline passes.
+	void ParkAction(UECFActionBase* Action, float InDeadlineTime);
+
+	// Wakes up the parked action, so it will be ticked again.
+	void WakeAction(UECFActionBase* Action);
+
+	// Wakes up the parked action at the beginning of the next tick. Safe to use while iterating over actions.
+	void RequestWakeAction(UECFActionBase* Action);
+
+	// Wakes up actions which async work has been done. Actions with immediate continuation can be ticked right away.
+	void WakeCompletedActions(bool bTickImmediateContinuations);
+
+	// Schedules the deadline of the parked action, using the time left to it.
+	void ScheduleDeadline(UECFActionBase* Action);
+
+	// Advances all clocks and wakes up parked actions which deadlines have passed. 
+	// Clocks are advanced once per frame, by the first tick of any tick group.
+	void AdvanceClocks();
+
+	// Pauses or resumes the action. Paused parked actions have the time left to their deadlines frozen.
+	void SetActionPaused(UECFActionBase* Action, bool bPaused);
+
 	// Utility function to check action validity.
 	static bool IsActionValid(UECFActionBase* Action);
 
+	// Actions of one owner whose lifetime is tracked by the subsystem.
+	struct FECFTrackedOwner
+	{
+		TWeakObjectPtr<const UObject> Owner;
+		TArray<TWeakObjectPtr<UECFActionBase>> Actions;
+		bool bIsBoundToActor = false;
+	};
+
+	// Owners with tracked lifetime and their actions.
+	TMap<FObjectKey, FECFTrackedOwner> TrackedOwners;
+
+	// Handle of the post garbage collection callback used to validate tracked owners.
+	FDelegateHandle PostGarbageCollectHandle;
+
+	// Starts tracking the lifetime of the given action's owner.
+	void TrackOwnerLifetime(UECFActionBase* Action);
+
+	// Stops tracking the given action. Stops tracking the owner when it has no more actions.
+	void UntrackOwnerLifetime(UECFActionBase* Action);
+
+	// Invalidates all actions of the given tracked owner and stops tracking it.
+	void InvalidateOwnerActions(const FObjectKey& OwnerKey);
+
+	// Validates tracked owners once after each garbage collection.
+	void OnPostGarbageCollect();
+
+	// Tracked Actor owners callbacks.
+	UFUNCTION()
+	void OnTrackedActorDestroyed(AActor* DestroyedActor);
+
+	UFUNCTION()
+	void OnTrackedActorEndPlay(AActor* Actor, EEndPlayReason::Type EndPlayReason);
+
 private:
 
 	// Indicates if this subsystem should tick
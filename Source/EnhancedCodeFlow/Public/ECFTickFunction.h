@@ -0,0 +1,45 @@
+// Copyright (c) 2026 Damian Nowakowski. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/EngineBaseTypes.h"
+#include "ECFTypes.h"
+#include "ECFTickFunction.generated.h"
+
+ECF_PRAGMA_DISABLE_OPTIMIZATION
+
+class UECFSubsystem;
+
+/**
+ * Tick function registered with the world, which ticks actions of one ECF tick group.
+ */
+USTRUCT()
+struct ENHANCEDCODEFLOW_API FECFTickFunction : public FTickFunction
+{
+	GENERATED_BODY()
+
+	// Subsystem owning the actions of the tick group.
+	UECFSubsystem* Subsystem = nullptr;
+
+	// The tick group which actions are ticked.
+	EECFTickGroup Group = EECFTickGroup::Default;
+
+	// Level in which this tick function has been registered.
+	TWeakObjectPtr<ULevel> RegisteredLevel;
+
+	/** FTickFunction interface implementation */
+	void ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) override;
+	FString DiagnosticMessage() override;
+};
+
+template<>
+struct TStructOpsTypeTraits<FECFTickFunction> : public TStructOpsTypeTraitsBase2<FECFTickFunction>
+{
+	enum
+	{
+		WithCopy = false
+	};
+};
+
+ECF_PRAGMA_ENABLE_OPTIMIZATION
\ No newline at end of file
@@ -0,0 +1,30 @@
+// Copyright (c) 2026 Damian Nowakowski. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+ECF_PRAGMA_DISABLE_OPTIMIZATION
+
+/**
+ * Policy of lowering the tick rate of actions with the Tick LOD setting, depending on the significance of their owners.
+ * An action with LOD level 0 ticks every frame, and every next level ticks half as often (every 2, 4, 8... frames).
+ * Ticks skipped this way are added to the delta time of the next tick.
+ */
+struct FECFTickLODPolicy
+{
+	// Distances from the nearest local player's view at which the LOD level goes up. Must be sorted ascending.
+	// Owners which are not actors, components or don't have a location stay at LOD level 0.
+	TArray<float> Distances = { 2000.f, 5000.f, 10000.f };
+
+	// Optional function returning the LOD level of the given owner. If set, it is used instead of Distances.
+	TFunction<int32(const UObject* /*Owner*/)> GetLODLevel;
+
+	// Time in seconds between updates of the LOD levels. LOD levels are not updated every frame.
+	float UpdateInterval = 0.5f;
+
+	// The highest LOD level. Actions with it tick every 2^MaxLODLevel frames.
+	static constexpr int32 MaxLODLevel = 7;
+};
+
+ECF_PRAGMA_ENABLE_OPTIMIZATION
\ No newline at end of file
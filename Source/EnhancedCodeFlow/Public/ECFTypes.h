@@ -16,6 +16,51 @@ enum class EECFBlendFunc : uint8
 	ECFBlend_EaseInOut
 };
 
+// Points of the frame in which actions can be ticked.
+UENUM(BlueprintType)
+enum class EECFTickGroup : uint8
+{
+	// Ticked by the ECF subsystem, after physics and before cameras are updated.
+	Default,
+
+	// Ticked before physics simulation (TG_PrePhysics).
+	PrePhysics,
+
+	// Ticked after physics simulation (TG_PostPhysics).
+	PostPhysics,
+
+	// Ticked at the end of the frame, after cameras are updated (TG_PostUpdateWork).
+	EndOfFrame
+};
+
+// Priority tiers of actions ticked within the ECF tick budget.
+UENUM(BlueprintType)
+enum class EECFTickPriority : uint8
+{
+	// Never deferred, even when the tick budget is exceeded.
+	High,
+
+	// Deferred to the next tick when the tick budget is exceeded.
+	Normal,
+
+	// Ticked after all other actions, only if there is any budget left.
+	Low
+};
+
+// Ways of handling interval ticks missed because the frame was longer than the tick interval.
+UENUM(BlueprintType)
+enum class EECFIntervalCatchUp : uint8
+{
+	// Ticks once with the interval. Missed ticks are skipped, but the phase of the next ticks is kept.
+	Skip,
+
+	// Ticks with the interval as many times as the interval has passed.
+	FireAll,
+
+	// Ticks once with the summed intervals that have passed.
+	FireOnce
+};
+
 // Possible priorities for async tasks in ECF system.
 UENUM(BlueprintType)
 enum class EECFAsyncPrio : uint8
@@ -31,6 +31,13 @@
 #include "ECFTypes.h"
 #include "ECFActionSettings.h"
 #include "ECFInstanceId.h"
+#include "ECFCommandBuffer.h"
+#include "ECFCancellationToken.h"
+#include "ECFSignal.h"
+#include "ECFAsyncLane.h"
+#include "ECFClock.h"
+#include "ECFTickLOD.h"
+#include "ECFPipelineTypes.h"
 #include "Coroutines/ECFCoroutineAwaiters.h"
 #include "ECFConcepts.h"
 
@@ -120,6 +127,92 @@ public:
 	 */
 	static bool GetPause(const UObject* WorldContextObject);
 
+	/**
+	 * Pauses all actions of the given action group, set with FECFActionSettings().WithActionGroup(ActionGroupName).
+	 * The group is paused as a whole, starting from the next tick, without touching its actions.
+	 */
+	static void PauseActionGroup(const UObject* WorldContextObject, FName ActionGroupName);
+
+	/**
+	 * Resumes all actions of the given action group.
+	 */
+	static void ResumeActionGroup(const UObject* WorldContextObject, FName ActionGroupName);
+
+	/**
+	 * Checks if the given action group is paused.
+	 */
+	static bool IsActionGroupPaused(const UObject* WorldContextObject, FName ActionGroupName);
+
+	/**
+	 * Sets the time dilation of all actions of the given action group, applied on top of their clocks, starting from the next tick.
+	 */
+	static void SetActionGroupTimeDilation(const UObject* WorldContextObject, FName ActionGroupName, float TimeDilation);
+
+	/**
+	 * Gets the time dilation of the given action group.
+	 */
+	static float GetActionGroupTimeDilation(const UObject* WorldContextObject, FName ActionGroupName);
+
+	/**
+	 * Sets the policy computing tick LOD levels of actions launched with bUseTickLOD setting.
+	 * Actions with LOD level N tick every 2^N frames, receiving the delta time of all skipped frames.
+	 */
+	static void SetTickLODPolicy(const UObject* WorldContextObject, const FECFTickLODPolicy& Policy);
+
+	/**
+	 * Queues the commands controlling actions (stop, pause, resume, reset, set time).
+	 * Can be called from any thread. Commands are applied in the order they were queued
+	 * at the beginning of the next ECF tick, right after actions started from other threads are created.
+	 */
+	static void QueueCommands(const UObject* WorldContextObject, FECFCommandBuffer Commands);
+
+	/**
+	 * Immediately applies the commands controlling actions in the order they were recorded.
+	 * All actions are found in one pass, so it is cheaper than controlling many actions one by one.
+	 * Must be called from the Game Thread.
+	 */
+	static void ApplyCommands(const UObject* WorldContextObject, const FECFCommandBuffer& Commands);
+
+	/**
+	 * Sets the maximum number of async tasks running at once in the given async lane. Creates the lane if it doesn't exist yet.
+	 * Actions are assigned to lanes using FECFActionSettings().WithAsyncLane(LaneName, Priority).
+	 * Lanes used without setting them up allow only one task at once.
+	 */
+	static void SetAsyncLaneMaxInFlight(const UObject* WorldContextObject, FName LaneName, int32 MaxInFlight);
+
+	/**
+	 * Gets the statistics of the given async lane (tasks in flight, queue depth, wait and run times).
+	 * Returns false if there is no such lane.
+	 */
+	static bool GetAsyncLaneStats(const UObject* WorldContextObject, FName LaneName, FECFAsyncLaneStats& OutStats);
+
+	/**
+	 * Sets the time budget in milliseconds for ticking all actions in a single frame. 0 removes the budget (default).
+	 * When the budget is exceeded, actions are deferred to the next frame according to their tick priority
+	 * set with FECFActionSettings().WithTickPriority(Priority), and receive the accumulated delta time.
+	 * High priority actions are never deferred, Low priority actions are ticked last. An action is never deferred twice in a row.
+	 */
+	static void SetTickBudget(const UObject* WorldContextObject, float InBudgetMs);
+
+	/**
+	 * Gets the time budget in milliseconds for ticking all actions in a single frame. 0 means there is no budget.
+	 */
+	static float GetTickBudget(const UObject* WorldContextObject);
+
+	/**
+	 * Registers the custom clock with the given name, replacing the previously registered one.
+	 * Actions are assigned to clocks using FECFActionSettings().WithClock(ClockName).
+	 * The delta time of the clock is computed once per frame and used by all actions of the clock.
+	 * Must be called from the Game Thread.
+	 */
+	static void RegisterClock(const UObject* WorldContextObject, FName ClockName, const TSharedRef<FECFClockSource>& Clock);
+
+	/**
+	 * Unregisters the custom clock with the given name. Actions using it are stopped until the clock is registered again.
+	 * Must be called from the Game Thread.
+	 */
+	static void UnregisterClock(const UObject* WorldContextObject, FName ClockName);
+
 	/*^^^ Stop ECF Functions ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^*/
 
 	/**
@@ -169,6 +262,12 @@ public:
 	 * If the action doesn't support time or there is no action, it will return -1.
 	 */
 	static float GetActionTime(const UObject* WorldContextObject, const FECFHandle& Handle);
+
+	/**
+	 * Gets the action progress in range [0, 1], like the part of items processed by For Each Time Sliced.
+	 * If the action doesn't support progress or there is no action, it will return -1.
+	 */
+	static float GetActionProgress(const UObject* WorldContextObject, const FECFHandle& Handle);
 	
 	/**
 	 * Sets the action time. It's not CurrentTime, but the time value used by this action, like in delay or timeline.
@@ -312,6 +411,41 @@ public:
 	[[deprecated("Function deprecated. Use StopAllActionsOfClass<UECFWhileTrueExecute> instead.")]]
 	static void RemoveAllWhileTrueExecutes(const UObject* WorldContextObject, bool bComplete = false, UObject* InOwner = nullptr);
 
+	/*^^^ For Each Time Sliced ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^*/
+
+	/**
+	 * Calls the item function for every index in range [0, InNum) on the Game Thread, processing as many items per tick
+	 * as fit into the given time budget. The number of items processed at once adapts to the measured cost of an item.
+	 * At least one item is processed every tick. Use GetActionProgress to check how many items have been processed.
+	 * Can be resetted. It starts processing from the first item again.
+	 * @param InNum					- the number of indices to process.
+	 * @param InBudgetMs			- the time in milliseconds the items can take in a single tick. Must be greater than 0.
+	 * @param InItemFunc			- a function processing one index. Must be: [](int32 Index) -> void.
+	 * @param InDoneFunc			- a callback with action to execute when all items are processed or the action is stopped. 
+	 *								  If there are no items, it is called on the first tick of the action. Can be:
+	 *	[](bool bStopped) -> void.
+	 *	[]() -> void.
+	 * @param Settings [optional]	- an extra settings to apply to this action.
+	 */
+	static FECFHandle ForEachTimeSliced(const UObject* InOwner, int32 InNum, float InBudgetMs, TUniqueFunction<void(int32/* Index*/)>&& InItemFunc, TUniqueFunction<void(bool/* bStopped*/)>&& InDoneFunc, const FECFActionSettings& Settings = {});
+	static FECFHandle ForEachTimeSliced(const UObject* InOwner, int32 InNum, float InBudgetMs, TUniqueFunction<void(int32/* Index*/)>&& InItemFunc, TUniqueFunction<void()>&& InDoneFunc, const FECFActionSettings& Settings = {});
+
+	/**
+	 * Calls the item function for every item of the given array, processing as many items per tick as fit into the given time budget.
+	 * The array is moved into the action, so it can't be changed from outside while being processed.
+	 * Usage: FFlow::ForEachTimeSliced(this, MoveTemp(SpawnParams), 2.f, [this](FMySpawnParams& Params) { ... }, [this](bool bStopped) { ... });
+	 * @param InItemFunc			- a function processing one item. Must be: [](TItem& Item) -> void.
+	 */
+	template<typename TItem, typename TItemFunc, typename TDoneFunc>
+	static FECFHandle ForEachTimeSliced(const UObject* InOwner, TArray<TItem>&& InItems, float InBudgetMs, TItemFunc&& InItemFunc, TDoneFunc&& InDoneFunc, const FECFActionSettings& Settings = {})
+	{
+		const int32 ItemsNum = InItems.Num();
+		return ForEachTimeSliced(InOwner, ItemsNum, InBudgetMs, [Items = MoveTemp(InItems), Func = Forward<TItemFunc>(InItemFunc)](int32 Index) mutable
+		{
+			Func(Items[Index]);
+		}, Forward<TDoneFunc>(InDoneFunc), Settings);
+	}
+
 	/*^^^ Timeline ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^*/
 
 	/**
@@ -527,19 +661,48 @@ public:
 
 	/**
 	 * Runs the given task function on a separate thread and calls the callback function when this task ends.
-	 * @param InAsyncTaskFunc		- a task that will be running on a separate thread. Must be: []() -> void.
+	 * @param InAsyncTaskFunc		- a task that will be running on a separate thread. 
+	 *	Can be: [](const FECFCancellationToken& CancellationToken) -> void.
+	 *	Can be: []() -> void.
+	 *	The cancellation token is cancelled when the action is stopped, timed out or removed because its owner died.
+	 *	Check it from time to time in long running tasks to bail out early.
 	 * @param InCallbackFunc		- a callback with action to execute when the async task ends. Will return bool indicating if the callback was called because of the timeout. 
 	 *	Can be: [](bool bTimedOut, bool bStopped) -> void.
 	 *	Can be: [](bool bTimedOut) -> void.
 	 *	Can be: []() -> void.
 	 * @param InTimeOut				- if greater than 0.f it will apply timeout to this action. After this time the CallbackFunc will be called with a bTimedOut parameter set to true.
-	 *								  Have in mind, that the timeout will not stop the running async thread, it just won't trigger callback when the async task ends. Handle timeout on the side of the async task itself.
+	 *								  Have in mind, that the timeout will not stop the running async thread, it just won't trigger callback when the async task ends. 
+	 *								  Use the cancellation token to stop the async task early.
 	 * @param InThreadPriority		- thread priority (can be Normal or HiPriority).
 	 * @param Settings [optional]	- an extra settings to apply to this action.
 	 */
 	static FECFHandle RunAsyncThen(const UObject* InOwner, TUniqueFunction<void()>&& InAsyncTaskFunc, TUniqueFunction<void(bool/* bTimedOut*/, bool/* bStopped*/)>&& InCallbackFunc, float InTimeOut = 0.f, EECFAsyncPrio InThreadPriority = EECFAsyncPrio::Normal, const FECFActionSettings& Settings = {});
 	static FECFHandle RunAsyncThen(const UObject* InOwner, TUniqueFunction<void()>&& InAsyncTaskFunc, TUniqueFunction<void(bool/* bStopped*/)>&& InCallbackFunc, float InTimeOut = 0.f, EECFAsyncPrio InThreadPriority = EECFAsyncPrio::Normal, const FECFActionSettings& Settings = {});
 	static FECFHandle RunAsyncThen(const UObject* InOwner, TUniqueFunction<void()>&& InAsyncTaskFunc, TUniqueFunction<void()>&& InCallbackFunc, float InTimeOut = 0.f, EECFAsyncPrio InThreadPriority = EECFAsyncPrio::Normal, const FECFActionSettings& Settings = {});
+	static FECFHandle RunAsyncThen(const UObject* InOwner, TUniqueFunction<void(const FECFCancellationToken&/* CancellationToken*/)>&& InAsyncTaskFunc, TUniqueFunction<void(bool/* bTimedOut*/, bool/* bStopped*/)>&& InCallbackFunc, float InTimeOut = 0.f, EECFAsyncPrio InThreadPriority = EECFAsyncPrio::Normal, const FECFActionSettings& Settings = {});
+	static FECFHandle RunAsyncThen(const UObject* InOwner, TUniqueFunction<void(const FECFCancellationToken&/* CancellationToken*/)>&& InAsyncTaskFunc, TUniqueFunction<void(bool/* bStopped*/)>&& InCallbackFunc, float InTimeOut = 0.f, EECFAsyncPrio InThreadPriority = EECFAsyncPrio::Normal, const FECFActionSettings& Settings = {});
+	static FECFHandle RunAsyncThen(const UObject* InOwner, TUniqueFunction<void(const FECFCancellationToken&/* CancellationToken*/)>&& InAsyncTaskFunc, TUniqueFunction<void()>&& InCallbackFunc, float InTimeOut = 0.f, EECFAsyncPrio InThreadPriority = EECFAsyncPrio::Normal, const FECFActionSettings& Settings = {});
+
+	/**
+	 * Runs the given task function on a separate thread and passes its result to the callback function when this task ends.
+	 * The result is stored inside the action and moved to the callback, so there is no need for any shared state.
+	 * Usage: FFlow::RunAsyncThen<int32>(this, []() { return 42; }, [this](TOptional<int32>&& Result, bool bTimedOut, bool bStopped) {});
+	 * @param InAsyncTaskFunc		- a task that will be running on a separate thread.
+	 *	Can be: [](const FECFCancellationToken& CancellationToken) -> TResult.
+	 *	Can be: []() -> TResult.
+	 * @param InCallbackFunc		- a callback with action to execute when the async task ends. The result is empty if the task hasn't finished.
+	 *	Can be: [](TOptional<TResult>&& Result, bool bTimedOut, bool bStopped) -> void.
+	 *	Can be: [](TOptional<TResult>&& Result, bool bTimedOut) -> void.
+	 *	Can be: [](TOptional<TResult>&& Result) -> void.
+	 * @param InTimeOut				- if greater than 0.f it will apply timeout to this action. After this time the CallbackFunc will be called with a bTimedOut parameter set to true.
+	 * @param InThreadPriority		- thread priority (can be Normal or HiPriority).
+	 * @param Settings [optional]	- an extra settings to apply to this action.
+	 */
+	template<typename TResult, typename TTask, typename TCallback>
+	static FECFHandle RunAsyncThen(const UObject* InOwner, TTask&& InAsyncTaskFunc, TCallback&& InCallbackFunc, float InTimeOut = 0.f, EECFAsyncPrio InThreadPriority = EECFAsyncPrio::Normal, const FECFActionSettings& Settings = {})
+	{
+		return RunAsyncJobThen(InOwner, MakeECFAsyncJob<TResult>(Forward<TTask>(InAsyncTaskFunc), Forward<TCallback>(InCallbackFunc)), InTimeOut, InThreadPriority, Settings);
+	}
 
 	/**
 	 * Stops Run Async Thens. Have in mind it will not stop running async threads. 
@@ -551,6 +714,49 @@ public:
 	[[deprecated("Function deprecated. Use StopAllActionsOfClass<UECFRunAsyncThen> instead.")]]
 	static void RemoveAllRunAsyncThen(const UObject* WorldContextObject, UObject* InOwner = nullptr);
 
+	/*^^^ Parallel For Then ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^*/
+
+	/**
+	 * Runs the given body function for every index in range [0, InNum) on separate threads and calls the callback function when all of them are done.
+	 * The range is split into batches of InBatchSize indices, which are processed by tasks in the task graph.
+	 * Workers are not blocked waiting for each other, and the callback is called on the Game Thread exactly once.
+	 * @param InNum					- the number of indices to process.
+	 * @param InBodyFunc			- a function processing one index. It is called from many threads at once. Must be: [](int32 Index) -> void.
+	 * @param InCallbackFunc		- a callback with action to execute when all indices are processed.
+	 *	Can be: [](bool bTimedOut, bool bStopped) -> void.
+	 *	Can be: [](bool bTimedOut) -> void.
+	 *	Can be: []() -> void.
+	 * @param InBatchSize			- the number of indices processed by one batch. Use bigger batches for cheap bodies.
+	 * @param InTimeOut				- if greater than 0.f it will apply timeout to this action. After this time the CallbackFunc will be called with a bTimedOut parameter set to true.
+	 *								  Stopping the action or reaching the timeout stops processing batches that haven't started yet.
+	 * @param InThreadPriority		- thread priority (can be Normal or HiPriority).
+	 * @param Settings [optional]	- an extra settings to apply to this action.
+	 */
+	static FECFHandle ParallelForThen(const UObject* InOwner, int32 InNum, TUniqueFunction<void(int32/* Index*/)>&& InBodyFunc, TUniqueFunction<void(bool/* bTimedOut*/, bool/* bStopped*/)>&& InCallbackFunc, int32 InBatchSize = 1, float InTimeOut = 0.f, EECFAsyncPrio InThreadPriority = EECFAsyncPrio::Normal, const FECFActionSettings& Settings = {});
+	static FECFHandle ParallelForThen(const UObject* InOwner, int32 InNum, TUniqueFunction<void(int32/* Index*/)>&& InBodyFunc, TUniqueFunction<void(bool/* bTimedOut*/)>&& InCallbackFunc, int32 InBatchSize = 1, float InTimeOut = 0.f, EECFAsyncPrio InThreadPriority = EECFAsyncPrio::Normal, const FECFActionSettings& Settings = {});
+	static FECFHandle ParallelForThen(const UObject* InOwner, int32 InNum, TUniqueFunction<void(int32/* Index*/)>&& InBodyFunc, TUniqueFunction<void()>&& InCallbackFunc, int32 InBatchSize = 1, float InTimeOut = 0.f, EECFAsyncPrio InThreadPriority = EECFAsyncPrio::Normal, const FECFActionSettings& Settings = {});
+
+	/*^^^ Run Pipeline ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^*/
+
+	/**
+	 * Runs the pipeline of stages processing the typed payload. Stages run in order, each one on its own context:
+	 * on the Game Thread, on a background thread or streaming assets. Consecutive worker stages run one after another
+	 * without returning to the Game Thread. The payload is moved between stages without copying.
+	 * Usage: FFlow::RunPipeline(this, TECFPipeline<FMyChunk>(MoveTemp(Chunk)).OnWorker(...).OnGameThread(...), [this](TOptional<FMyChunk>&& Chunk, const FECFPipelineReport& Report) {});
+	 * @param InPipeline			- the pipeline with the payload and stages.
+	 * @param InCallbackFunc		- a callback with action to execute when the pipeline ends, with the timings of finished stages.
+	 *								  The payload is empty if the pipeline has been stopped while a worker stage was using it.
+	 *	Must be: [](TOptional<TPayload>&& Payload, const FECFPipelineReport& Report) -> void.
+	 * @param InThreadPriority		- thread priority of worker stages (can be Normal or HiPriority).
+	 * @param Settings [optional]	- an extra settings to apply to this action.
+	 */
+	template<typename TPayload, typename TCallback>
+	static FECFHandle RunPipeline(const UObject* InOwner, TECFPipeline<TPayload>&& InPipeline, TCallback&& InCallbackFunc, EECFAsyncPrio InThreadPriority = EECFAsyncPrio::Normal, const FECFActionSettings& Settings = {})
+	{
+		InPipeline.SetCallback(Forward<TCallback>(InCallbackFunc));
+		return RunPipelineDesc(InOwner, MoveTemp(static_cast<FECFPipeline&>(InPipeline)), InThreadPriority, Settings);
+	}
+
 	/*^^^ Load Objects Async ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^*/
 
 	/**
@@ -637,16 +843,48 @@ public:
 	 */
 	static FECFCoroutineAwaiter_WaitForFlag WaitForFlag(const UObject* InOwner, bool* bInFlag, float InTimeOut = 0.f, const FECFActionSettings& Settings = {});
 
+	/*^^^ Wait For Signal (Coroutine) ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^*/
+
+	/**
+	 * Suspends running coroutine function until the given signal is set. The signal can be set from any thread.
+	 * The action doesn't tick while waiting.
+	 * @param InSignal				- a signal that resumes the suspended function when it is set.
+	 * @param InTimeOut				- if greater than 0.f it will apply timeout to this action. After this timeout the suspended function will be resumed.
+	 * @param Settings [optional]	- an extra settings to apply to this action.
+	 */
+	static FECFCoroutineAwaiter_WaitForSignal WaitForSignal(const UObject* InOwner, const FECFSignal& InSignal, float InTimeOut = 0.f, const FECFActionSettings& Settings = {});
+
 	/*^^^ Run Async And Wait (Coroutine) ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^*/
 	
 	/**
-	 * Suspends running coroutine function until the given predicate won't return true.
-	 * @param InPredicate			- a function that decides if the suspended function should be resumed.
-	 *								  If it returns true it means the suspended function must be resumed. Must be: [](float DeltaTime) -> bool
+	 * Suspends running coroutine function until the given async task ends.
+	 * @param InAsyncTaskFunc		- a task that will be running on a separate thread.
+	 *	Can be: [](const FECFCancellationToken& CancellationToken) -> void.
+	 *	Can be: []() -> void.
+	 *	The cancellation token is cancelled when the action is stopped, timed out or removed because its owner died.
 	 * @param InTimeOut				- if greater than 0.f it will apply timeout to this action. After this timeout the suspended function will be resumed.
+	 * @param InThreadPriority		- Priority of the thread that will be used to run the async task.
 	 * @param Settings [optional]	- an extra settings to apply to this action.
 	 */
 	static FECFCoroutineAwaiter_RunAsyncAndWait RunAsyncAndWait(const UObject* InOwner, TUniqueFunction<void()>&& InAsyncTaskFunc, float InTimeOut = 0.f, EECFAsyncPrio InThreadPriority = EECFAsyncPrio::Normal, const FECFActionSettings& Settings = {});
+	static FECFCoroutineAwaiter_RunAsyncAndWait RunAsyncAndWait(const UObject* InOwner, TUniqueFunction<void(const FECFCancellationToken&/* CancellationToken*/)>&& InAsyncTaskFunc, float InTimeOut = 0.f, EECFAsyncPrio InThreadPriority = EECFAsyncPrio::Normal, const FECFActionSettings& Settings = {});
+
+	/**
+	 * Suspends running coroutine function until the given async task ends and returns the task's result.
+	 * Usage: auto [bStopped, bTimedOut, Result] = co_await FFlow::RunAsyncAndWait<int32>(this, []() { return 42; });
+	 * The Result is a TOptional<TResult>, which is empty if the task hasn't finished.
+	 * @param InAsyncTaskFunc		- a task that will be running on a separate thread.
+	 *	Can be: [](const FECFCancellationToken& CancellationToken) -> TResult.
+	 *	Can be: []() -> TResult.
+	 * @param InTimeOut				- if greater than 0.f it will apply timeout to this action. After this timeout the suspended function will be resumed.
+	 * @param InThreadPriority		- Priority of the thread that will be used to run the async task.
+	 * @param Settings [optional]	- an extra settings to apply to this action.
+	 */
+	template<typename TResult, typename TTask>
+	static TECFCoroutineAwaiter_RunAsyncAndWait<TResult, typename TDecay<TTask>::Type> RunAsyncAndWait(const UObject* InOwner, TTask&& InAsyncTaskFunc, float InTimeOut = 0.f, EECFAsyncPrio InThreadPriority = EECFAsyncPrio::Normal, const FECFActionSettings& Settings = {})
+	{
+		return TECFCoroutineAwaiter_RunAsyncAndWait<TResult, typename TDecay<TTask>::Type>(InOwner, Settings, Forward<TTask>(InAsyncTaskFunc), InTimeOut, InThreadPriority);
+	}
 
 	/**
 	 * Stops all Wait Until coroutine actions.
@@ -702,6 +940,14 @@ public:
 	 * @param Settings [optional]	- an extra settings to apply to this action.
 	 */
 	static FECFCoroutineAwaiter_LoopAndWait LoopAndWait(const UObject* InOwner, TUniqueFunction<bool()>&& InPredicate, TUniqueFunction<void(float)>&& InTickFunc, float InTimeOut = 0.f, const FECFActionSettings& Settings = {});
+
+private:
+
+	// Runs the async job created by the typed Run Async Then.
+	static FECFHandle RunAsyncJobThen(const UObject* InOwner, FECFAsyncJobPtr&& InAsyncJob, float InTimeOut, EECFAsyncPrio InThreadPriority, const FECFActionSettings& Settings);
+
+	// Runs the type erased pipeline created by the typed Run Pipeline.
+	static FECFHandle RunPipelineDesc(const UObject* InOwner, FECFPipeline&& InPipeline, EECFAsyncPrio InThreadPriority, const FECFActionSettings& Settings);
 };
 
 using FFlow = FEnhancedCodeFlow;
\ No newline at end of file